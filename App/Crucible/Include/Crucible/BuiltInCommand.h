@@ -56,6 +56,16 @@ namespace Crucible {
      */
     auto help(int argc, char* argv[], const Environment& shell_env) -> int; // NOLINT
 
+    /**
+     * @brief Trace the system calls of an app and print the trace or the system call latency
+     *          histograms.
+     * @param argc
+     * @param argv
+     * @param shell_env
+     * @return
+     */
+    auto strace(int argc, char* argv[], const Environment& shell_env) -> int; // NOLINT
+
     /**
      * @brief Add all built-in shell commands to the command table of the shell env.
      * @param shell_env
@@ -16,8 +16,13 @@
 
 #include <Crucible/BuiltInCommand.h>
 
+#include <Ember/AppBits.h>
+#include <Ember/SystemCall.h>
+#include <Ember/SystemCallID.h>
+
 #include <Forge/App.h>
 
+#include <fstream>
 #include <iostream>
 #include <string>
 #include <unordered_map>
@@ -27,6 +32,74 @@
 namespace Crucible {
     std::unordered_map<std::string, std::string> HELP_TEXT_TABLE; // NOLINT needs to be mutable
 
+    /// @brief Trace cursor of each CPU core, so "strace log" only prints new records.
+    std::unordered_map<U64, U64> TRACE_CURSORS; // NOLINT needs to be mutable
+
+    namespace {
+        /// @brief Upper bound of system calls with latency statistics.
+        constexpr size_t SYSTEM_CALL_STATS_LIMIT = 128;
+
+        auto system_call_name(const Ember::ResourceID ID) -> std::string {
+            switch (ID / 100) {
+                case 1:  return Ember::Memory(ID).to_string();
+                case 2:  return Ember::Threading(ID).to_string();
+                case 3:  return Ember::VFS(ID).to_string();
+                case 4:  return Ember::App(ID).to_string();
+                default: return std::to_string(ID);
+            }
+        }
+
+        void print_trace(std::ostream& out) {
+            std::array<Ember::SystemCallTraceRecord, Ember::SYSTEM_CALL_TRACE_READ_LIMIT> records{};
+            for (U64 core_id = 0;; core_id++) {
+                U64&              cursor = TRACE_CURSORS[core_id];
+                Ember::StatusCode count  = 0;
+                do {
+                    count = Ember::system_call(Ember::App::READ_SYSTEM_CALL_TRACE,
+                                               core_id,
+                                               reinterpret_cast<U64>(&cursor),
+                                               reinterpret_cast<U64>(records.data()),
+                                               records.size());
+                    // No trace of the core -> All cores have been printed
+                    if (count == Ember::Status::UNKNOWN_ID) return;
+                    for (Ember::StatusCode i = 0; i < count; i++) {
+                        const auto& r = records[i];
+                        out << "[" << core_id << ":" << r.sequence << "] App" << r.app_handle
+                            << "-Thread" << r.thread_handle << " " << system_call_name(r.ID)
+                            << "(" << std::hex;
+                        for (size_t j = 0; j < std::size(r.args); j++)
+                            out << (j > 0 ? ", 0x" : "0x") << r.args[j];
+                        out << std::dec << ") = " << r.status << " <" << r.cycles << " cycles>"
+                            << std::endl;
+                    }
+                } while (count == static_cast<Ember::StatusCode>(records.size()));
+            }
+        }
+
+        auto print_histograms(std::ostream& out) -> bool {
+            std::array<Ember::SystemCallStats, SYSTEM_CALL_STATS_LIMIT> stats{};
+
+            const Ember::StatusCode count =
+                Ember::system_call(Ember::App::READ_SYSTEM_CALL_STATS,
+                                   reinterpret_cast<U64>(stats.data()),
+                                   stats.size());
+            if (count < Ember::Status::OKAY) return false;
+
+            for (Ember::StatusCode i = 0; i < count; i++) {
+                const auto& s = stats[i];
+                out << system_call_name(s.ID) << ": " << s.count << " calls, avg "
+                    << s.total_cycles / s.count << " cycles, max " << s.max_cycles << " cycles"
+                    << std::endl;
+                for (size_t b = 0; b < Ember::SYSTEM_CALL_LATENCY_BUCKETS; b++) {
+                    if (s.latency_histogram[b] == 0) continue;
+                    out << "    >= 2^" << b << " cycles: " << s.latency_histogram[b]
+                        << std::endl;
+                }
+            }
+            return true;
+        }
+    } // namespace
+
     auto cd(const int argc, char* argv[], Environment& shell_env) -> int { // NOLINT
         if (argc == 0)
             // Stay in the current directory
@@ -118,14 +191,76 @@ namespace Crucible {
         std::cout << "    pwd" << std::endl;
         std::cout << "    clear" << std::endl;
         std::cout << "    help [command]" << std::endl;
+        std::cout << "    strace [on|off|log|hist] [app|file]" << std::endl;
+        return 0;
+    }
+
+    auto strace(const int argc, char* argv[], const Environment& shell_env) -> int { // NOLINT
+        SILENCE_UNUSED(shell_env)
+        if (argc == 0) {
+            std::cerr << "Error: Missing sub command, see 'help strace'." << std::endl;
+            return -1;
+        }
+
+        const std::string sub_cmd = argv[0];
+        if (sub_cmd == "on" || sub_cmd == "off") {
+            if (argc != 2) {
+                std::cerr << "Error: Expected an app ID." << std::endl;
+                return -1;
+            }
+            const std::string app_ID = argv[1];
+            U64               app    = 0;
+            for (const char c : app_ID) {
+                if (c < '0' || c > '9') {
+                    std::cerr << "'" << app_ID << "' - Not a number." << std::endl;
+                    return -1;
+                }
+                app = app * 10 + (c - '0');
+            }
+            const Ember::StatusCode ret =
+                Ember::system_call(Ember::App::TRACE_SYSTEM_CALLS, app, sub_cmd == "on" ? 1 : 0);
+            if (ret < Ember::Status::OKAY) {
+                std::cerr << "'" << app_ID << "': " << Ember::Status(ret).to_string() << std::endl;
+                return -1;
+            }
+            return 0;
+        }
+
+        if (sub_cmd != "log" && sub_cmd != "hist") {
+            std::cerr << "Error: Unknown sub command '" << sub_cmd << "'." << std::endl;
+            return -1;
+        }
+        if (argc > 2) {
+            std::cerr << "Error: Too many arguments" << std::endl;
+            return -1;
+        }
+        std::ofstream dump_file;
+        if (argc == 2) {
+            dump_file.open(argv[1]);
+            if (!dump_file.is_open()) {
+                std::cerr << "'" << argv[1] << "': Cannot open file." << std::endl;
+                return -1;
+            }
+        }
+
+        std::ostream& out = argc == 2 ? dump_file : std::cout;
+        if (sub_cmd == "log") {
+            print_trace(out);
+            return 0;
+        }
+        if (!print_histograms(out)) {
+            std::cerr << "Error: Failed to read the system call statistics." << std::endl;
+            return -1;
+        }
         return 0;
     }
 
     void register_builtin_commands(Environment& shell_env) {
-        shell_env.command_table["cd"]    = &cd;
-        shell_env.command_table["pwd"]   = &pwd;
-        shell_env.command_table["clear"] = &clear;
-        shell_env.command_table["help"]  = &help;
+        shell_env.command_table["cd"]     = &cd;
+        shell_env.command_table["pwd"]    = &pwd;
+        shell_env.command_table["clear"]  = &clear;
+        shell_env.command_table["help"]   = &help;
+        shell_env.command_table["strace"] = &strace;
 
         HELP_TEXT_TABLE["cd"] =
             "cd [directory]\n"
@@ -137,5 +272,14 @@ namespace Crucible {
         HELP_TEXT_TABLE["help"] =
             "help [command]\n"
             "    Display information about the shell or a built-in command.\n";
+        HELP_TEXT_TABLE["strace"] =
+            "strace on [app]\n"
+            "    Start tracing the system calls of an app.\n"
+            "strace off [app]\n"
+            "    Stop tracing the system calls of an app.\n"
+            "strace log [file]\n"
+            "    Print the system calls traced since the last 'strace log' or dump them to file.\n"
+            "strace hist [file]\n"
+            "    Print the latency histograms of the traced system calls or dump them to a file.\n";
     }
 } // namespace Crucible
@@ -0,0 +1,91 @@
+/*
+ *  Copyright 2025 Ewogijk
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef FREYA_SERVICECACHE_H
+#define FREYA_SERVICECACHE_H
+
+#include <Freya/Service.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace Freya {
+
+    /// @brief Identifies the content of a service file, a changed file gets a different stamp.
+    struct ServiceFileStamp {
+        std::uint64_t size = 0;
+        std::uint64_t hash = 0; // FNV-1a hash of the file content
+
+        /// @brief Compute the stamp of a service file.
+        /// @param content Content of the service file.
+        /// @return The stamp of the content.
+        static auto of(const std::string& content) -> ServiceFileStamp;
+
+        friend auto operator==(const ServiceFileStamp& lhs, const ServiceFileStamp& rhs) -> bool {
+            return lhs.size == rhs.size && lhs.hash == rhs.hash;
+        }
+    };
+
+    /// @brief The ServiceCache keeps the parsed services of a service directory in a compact
+    ///         binary file, so unchanged service files do not need to be parsed on every boot.
+    ///
+    /// The cache file starts with a header that contains the cache format and Freya version
+    /// followed by one entry per service file: File name, stamp of the file content and the
+    /// parsed service. A cache file with another format or Freya version is ignored.
+    class ServiceCache {
+        static constexpr std::uint32_t MAGIC   = 0x43595246; // "FRYC"
+        static constexpr std::uint32_t VERSION = 1;
+
+        struct Entry {
+            ServiceFileStamp stamp;
+            Service          service;
+            bool             used = false; // The service file still exists
+        };
+
+        std::unordered_map<std::string, Entry> _entries;
+        bool                                   _dirty = false;
+
+      public:
+        /// @brief Load the entries of the cache file, a missing or malformed cache file results
+        ///         in an empty cache.
+        /// @param cache_file Path to the cache file.
+        /// @return True: The cache file was loaded, False: The cache is empty.
+        auto load(const std::string& cache_file) -> bool;
+
+        /// @brief Find the cached service of a service file.
+        /// @param file_name Name of the service file.
+        /// @param stamp     Stamp of the current content of the service file.
+        /// @return The cached service or a nullptr if the file is not cached or has changed.
+        auto find(const std::string& file_name, const ServiceFileStamp& stamp) -> const Service*;
+
+        /// @brief Add or update the cached service of a service file.
+        /// @param file_name Name of the service file.
+        /// @param stamp     Stamp of the content of the service file.
+        /// @param service   The service parsed from the file.
+        void put(const std::string&      file_name,
+                 const ServiceFileStamp& stamp,
+                 const Service&          service);
+
+        /// @brief Write the cache file if a service was added or updated or a service file was not
+        ///         looked up, entries of service files that were not looked up are dropped.
+        /// @param cache_file Path to the cache file.
+        /// @return True: The cache file is up to date, False: Writing the cache file failed.
+        auto save(const std::string& cache_file) -> bool;
+    };
+} // namespace Freya
+
+#endif // FREYA_SERVICECACHE_H
@@ -31,6 +31,7 @@ namespace Freya {
     /// @brief The ServiceLoader is responsible to parse and verify *.service files
     class ServiceLoader {
         static constexpr std::string SERVICE_FILE_EXT = ".service";
+        static constexpr std::string CACHE_FILE_EXT   = ".cache";
 
         static constexpr const char* NAME               = "Name";
         static constexpr const char* DESCRIPTION        = "Description";
@@ -78,6 +79,10 @@ namespace Freya {
         /// Requires:
         ///   - CreateFilesInRoot
         ///
+        /// The parsed services are kept in the binary service cache "<directory>.cache". A service
+        /// file is only parsed when it is not in the cache or its content has changed, the cache
+        /// file is updated afterwards.
+        ///
         /// @param directory Directory with *.service files.
         /// @return A list of all valid services.
         auto load_services(const std::string& directory) -> std::vector<Service>;
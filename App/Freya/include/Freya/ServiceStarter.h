@@ -18,6 +18,7 @@
 #ifndef RUNEOS_SERVICESTARTER_H
 #define RUNEOS_SERVICESTARTER_H
 
+#include <chrono>
 #include <string>
 #include <vector>
 
@@ -26,21 +27,50 @@
 
 namespace Freya {
 
-    /// @brief The ServiceStarter starts all services as configured in the order determined by the
-    ///         topological order of the dependency graph.
+    /// @brief The ServiceStarter starts all services as configured, a service is started as soon as
+    ///         all its dependencies are ready.
     class ServiceStarter {
+        using Clock = std::chrono::steady_clock;
+
+        /// @brief Start progress of a single service.
+        struct ServiceProgress {
+            /// @brief Indices of the services that depend on this service.
+            std::vector<size_t> dependents;
+            /// @brief Number of dependencies that are not ready yet.
+            size_t pending_dependencies = 0;
+            /// @brief Time the service was started.
+            Clock::time_point start;
+            /// @brief Time the service was ready, that is it was started or has exited if Freya
+            ///         waits for its exit.
+            Clock::time_point ready;
+            /// @brief True: The service is ready or its start failed.
+            bool done = false;
+        };
+
         static auto split(const std::string& s, char delim) -> std::vector<std::string>;
 
+        /// @brief Print the longest chain of dependent services, the critical path determines
+        ///         how long the service start takes.
+        static void print_critical_path(ServiceRegistry&                    registry,
+                                        const std::vector<std::string>&     sorted_services,
+                                        const std::vector<ServiceProgress>& progress,
+                                        Clock::time_point                   boot_start);
+
       public:
-        /// @brief Start all services based on their topological order.
+        /// @brief Start all services as soon as their dependencies are ready.
+        ///
+        /// All services whose dependencies are ready are started at once. A service is ready when
+        /// it was started or, if 'service.wait_for_exit == true', when it has exited and
+        /// 'service.expected_exit_code == actual_exit_code'. Freya waits for the exit of all such
+        /// services at the same time and starts the dependents of a service as soon as it is
+        /// ready, independent services therefore run concurrently.
         ///
-        /// If starting a service fails, it will be skipped if it is not mandatory, otherwise no
-        /// more services will be started and the service start will be considered failed.
+        /// If starting a service fails or it exits with an unexpected exit code, the failure is
+        /// ignored if it is not mandatory, otherwise no more services will be started and the
+        /// service start will be considered failed.
         ///
-        /// Additionally, if 'service.wait_for_exit == true', then Freya will wait for the service
-        /// to finish and verify that 'service.expected_exit_code == actual_exit_code'. When the
-        /// condition is false, again, if the service is not mandatory the failure is ignored,
-        /// otherwise the service start is considered failed.
+        /// The start and ready time of each service and the critical path of the service start are
+        /// printed.
         ///
         /// @param registry Service registry.
         /// @param sorted_services Names of all services in topological ordering.
@@ -0,0 +1,93 @@
+/*
+ *  Copyright 2025 Ewogijk
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef FREYA_WAITSET_H
+#define FREYA_WAITSET_H
+
+#include <Ember/AppBits.h>
+#include <Ember/Ember.h>
+#include <Ember/SystemCall.h>
+#include <Ember/SystemCallID.h>
+
+#include <cstddef>
+
+namespace Freya {
+
+    /// @brief A kernel wait set that lets Freya wait for the exit of many services at once.
+    class WaitSet {
+        Ember::ResourceID _handle{0};
+
+      public:
+        WaitSet() = default;
+
+        ~WaitSet() {
+            if (_handle > 0) Ember::system_call(Ember::App::WAIT_SET_FREE, _handle);
+        }
+
+        WaitSet(const WaitSet&)                    = delete;
+        WaitSet(WaitSet&&)                         = delete;
+        auto operator=(const WaitSet&) -> WaitSet& = delete;
+        auto operator=(WaitSet&&) -> WaitSet&      = delete;
+
+        /// @brief Create the wait set in the kernel.
+        /// @return OKAY: The wait set can be used, FAULT: The app has no wait set handles left.
+        auto create() -> Ember::StatusCode {
+            const Ember::StatusCode st = Ember::system_call(Ember::App::WAIT_SET_CREATE);
+            if (st < Ember::Status::OKAY) return st;
+            _handle = st;
+            return Ember::Status::OKAY;
+        }
+
+        /// @brief Watch for the exit of an app.
+        /// @param app_ID    ID of the app.
+        /// @param user_data Reported back with the exit event.
+        /// @return OKAY: The app exit is watched, UNKNOWN_ID: The app does not exist (anymore).
+        auto add_app_exit(const Ember::ResourceID app_ID, const U64 user_data) const
+            -> Ember::StatusCode {
+            return Ember::system_call(Ember::App::WAIT_SET_ADD,
+                                      _handle,
+                                      Ember::WaitEventType::APP_EXIT,
+                                      app_ID,
+                                      user_data);
+        }
+
+        /// @brief Stop watching for the exit of an app, exit events are reported until they are
+        ///         removed.
+        /// @param app_ID ID of the app.
+        /// @return OKAY: The app exit is no longer watched, UNKNOWN_ID: It was not watched.
+        auto remove_app_exit(const Ember::ResourceID app_ID) const -> Ember::StatusCode {
+            return Ember::system_call(Ember::App::WAIT_SET_REMOVE,
+                                      _handle,
+                                      Ember::WaitEventType::APP_EXIT,
+                                      app_ID);
+        }
+
+        /// @brief Block until at least one watched app has exited.
+        /// @param events_out      Buffer for the exit events.
+        /// @param events_out_size Number of events that fit into the buffer.
+        /// @return >= 0: Number of exit events, < 0: The wait failed.
+        auto wait(Ember::WaitEvent* events_out, const size_t events_out_size) const
+            -> Ember::StatusCode {
+            return Ember::system_call(Ember::App::WAIT_SET_WAIT,
+                                      _handle,
+                                      reinterpret_cast<U64>(events_out),
+                                      events_out_size,
+                                      Ember::WAIT_FOREVER);
+        }
+    };
+} // namespace Freya
+
+#endif // FREYA_WAITSET_H
@@ -0,0 +1,168 @@
+/*
+ *  Copyright 2025 Ewogijk
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <Freya/ServiceCache.h>
+#include <Freya/Version.h>
+
+#include <fstream>
+#include <vector>
+
+namespace Freya {
+    namespace {
+        constexpr std::uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325;
+        constexpr std::uint64_t FNV_PRIME        = 0x100000001B3;
+        // A cache written by another Freya version is not trusted
+        constexpr std::uint32_t FREYA_VERSION = (MAJOR << 16) | (MINOR << 8) | PATCH;
+        // Lengths above these limits only come from a corrupted cache
+        constexpr std::uint32_t STRING_LIMIT     = 4096;
+        constexpr std::uint32_t DEPENDENCY_LIMIT = 256;
+
+        template <typename T> void write_value(std::ofstream& out, const T& value) {
+            out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template <typename T> auto read_value(std::ifstream& in, T& value) -> bool {
+            return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+        }
+
+        auto remaining_size(std::ifstream& in) -> std::uint64_t {
+            const std::streampos pos = in.tellg();
+            in.seekg(0, std::ios::end);
+            const std::streampos end = in.tellg();
+            in.seekg(pos);
+            return pos < 0 || end < pos ? 0 : static_cast<std::uint64_t>(end - pos);
+        }
+
+        void write_string(std::ofstream& out, const std::string& s) {
+            write_value(out, static_cast<std::uint32_t>(s.size()));
+            out.write(s.data(), static_cast<std::streamsize>(s.size()));
+        }
+
+        auto read_string(std::ifstream& in, std::string& s) -> bool {
+            std::uint32_t size = 0;
+            if (!read_value(in, size) || size > STRING_LIMIT || size > remaining_size(in))
+                return false;
+            s.resize(size);
+            return static_cast<bool>(in.read(s.data(), size));
+        }
+
+        void write_service(std::ofstream& out, const Service& service) {
+            write_string(out, service.name);
+            write_string(out, service.description);
+            write_string(out, service.exec_start);
+            write_value(out, static_cast<std::uint8_t>(service.wait_for_exit));
+            write_value(out, static_cast<std::int32_t>(service.expected_exit_code));
+            write_value(out, static_cast<std::uint8_t>(service.mandatory));
+            write_value(out, static_cast<std::uint32_t>(service.dependencies.size()));
+            for (auto& dependency : service.dependencies) write_string(out, dependency);
+        }
+
+        auto read_service(std::ifstream& in, Service& service) -> bool {
+            std::uint8_t  wait_for_exit      = 0;
+            std::int32_t  expected_exit_code = 0;
+            std::uint8_t  mandatory          = 0;
+            std::uint32_t dependency_count   = 0;
+            if (!read_string(in, service.name) || !read_string(in, service.description)
+                || !read_string(in, service.exec_start) || !read_value(in, wait_for_exit)
+                || !read_value(in, expected_exit_code) || !read_value(in, mandatory)
+                || !read_value(in, dependency_count) || dependency_count > DEPENDENCY_LIMIT
+                // Every dependency has at least its length stored
+                || dependency_count * sizeof(std::uint32_t) > remaining_size(in))
+                return false;
+            service.wait_for_exit      = wait_for_exit != 0;
+            service.expected_exit_code = expected_exit_code;
+            service.mandatory          = mandatory != 0;
+            service.dependencies.resize(dependency_count);
+            for (auto& dependency : service.dependencies)
+                if (!read_string(in, dependency)) return false;
+            return true;
+        }
+    } // namespace
+
+    auto ServiceFileStamp::of(const std::string& content) -> ServiceFileStamp {
+        std::uint64_t hash = FNV_OFFSET_BASIS;
+        for (const char c : content) {
+            hash ^= static_cast<std::uint8_t>(c);
+            hash *= FNV_PRIME;
+        }
+        return {.size = content.size(), .hash = hash};
+    }
+
+    auto ServiceCache::load(const std::string& cache_file) -> bool {
+        _entries.clear();
+        std::ifstream in(cache_file, std::ios::binary);
+        if (!in) return false;
+
+        std::uint32_t magic         = 0;
+        std::uint32_t version       = 0;
+        std::uint32_t freya_version = 0;
+        std::uint32_t entry_count   = 0;
+        if (!read_value(in, magic) || !read_value(in, version) || !read_value(in, freya_version)
+            || !read_value(in, entry_count) || magic != MAGIC || version != VERSION
+            || freya_version != FREYA_VERSION)
+            return false;
+
+        for (std::uint32_t i = 0; i < entry_count; ++i) {
+            std::string file_name;
+            Entry       entry;
+            if (!read_string(in, file_name) || !read_value(in, entry.stamp.size)
+                || !read_value(in, entry.stamp.hash) || !read_service(in, entry.service)) {
+                // A truncated cache must not be used, the services are parsed again
+                _entries.clear();
+                return false;
+            }
+            _entries[file_name] = entry;
+        }
+        return true;
+    }
+
+    auto ServiceCache::find(const std::string& file_name, const ServiceFileStamp& stamp)
+        -> const Service* {
+        auto it = _entries.find(file_name);
+        if (it == _entries.end() || !(it->second.stamp == stamp)) return nullptr;
+        it->second.used = true;
+        return &it->second.service;
+    }
+
+    void ServiceCache::put(const std::string&      file_name,
+                           const ServiceFileStamp& stamp,
+                           const Service&          service) {
+        _entries[file_name] = {.stamp = stamp, .service = service, .used = true};
+        _dirty              = true;
+    }
+
+    auto ServiceCache::save(const std::string& cache_file) -> bool {
+        std::vector<const std::pair<const std::string, Entry>*> used_entries;
+        for (auto& entry : _entries)
+            if (entry.second.used) used_entries.push_back(&entry);
+        if (!_dirty && used_entries.size() == _entries.size()) return true;
+
+        std::ofstream out(cache_file, std::ios::binary | std::ios::trunc);
+        if (!out) return false;
+        write_value(out, MAGIC);
+        write_value(out, VERSION);
+        write_value(out, FREYA_VERSION);
+        write_value(out, static_cast<std::uint32_t>(used_entries.size()));
+        for (const auto* entry : used_entries) {
+            write_string(out, entry->first);
+            write_value(out, entry->second.stamp.size);
+            write_value(out, entry->second.stamp.hash);
+            write_service(out, entry->second.service);
+        }
+        _dirty = !out;
+        return !_dirty;
+    }
+} // namespace Freya
@@ -14,12 +14,14 @@
  *  limitations under the License.
  */
 
+#include <Freya/ServiceCache.h>
 #include <Freya/ServiceLoader.h>
 
 #include <filesystem>
 #include <format>
 #include <fstream>
 #include <iostream>
+#include <iterator>
 
 #include "yaml-cpp/yaml.h"
 
@@ -78,26 +80,43 @@ namespace Freya {
         std::cout << "Load services: " << directory << std::endl;
         std::vector<Service>  services;
         std::filesystem::path dir(directory);
+        const std::string     cache_file = directory + CACHE_FILE_EXT;
+        ServiceCache          cache;
+        cache.load(cache_file);
         for (auto service_file : std::filesystem::directory_iterator(dir)) {
             try {
                 // Only load *.service files
                 if (std::filesystem::path(service_file).extension() != SERVICE_FILE_EXT) continue;
 
-                _c_doc = YAML::LoadFile(service_file.path());
+                const std::string file_name = service_file.path().filename().string();
+                std::ifstream     in(service_file.path(), std::ios::binary);
+                std::string       content((std::istreambuf_iterator<char>(in)),
+                                          std::istreambuf_iterator<char>());
+                const auto        stamp = ServiceFileStamp::of(content);
+                if (const Service* cached = cache.find(file_name, stamp); cached != nullptr) {
+                    services.push_back(*cached);
+                    std::cout << std::format("  {:<64}\033[38;2;13;188;121mOKAY\033[0m (cached)",
+                                             file_name)
+                              << std::endl;
+                    continue;
+                }
+
+                _c_doc = YAML::Load(content);
                 if (!verify_service_config()) {
-                    std::cout << std::format("  {:<64}\033[38;2;205;49;49mFAILED\033[0m",
-                                             service_file.path().filename().string())
+                    std::cout << std::format("  {:<64}\033[38;2;205;49;49mFAILED\033[0m", file_name)
                               << std::endl;
                     continue;
                 }
                 services.push_back(create_service());
-                std::cout << std::format("  {:<64}\033[38;2;13;188;121mOKAY\033[0m",
-                                         service_file.path().filename().string())
+                cache.put(file_name, stamp, services.back());
+                std::cout << std::format("  {:<64}\033[38;2;13;188;121mOKAY\033[0m", file_name)
                           << std::endl;
             } catch (YAML::ParserException& e) {
                 std::cout << "  Could not parse YAML: " << e.what() << std::endl;
             }
         }
+        if (!cache.save(cache_file))
+            std::cerr << "Could not write the service cache: " << cache_file << std::endl;
         return services;
     }
 } // namespace Freya
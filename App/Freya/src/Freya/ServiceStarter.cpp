@@ -15,15 +15,29 @@
  */
 
 #include <Freya/ServiceStarter.h>
+#include <Freya/WaitSet.h>
 
 #include <Forge/App.h>
 
+#include <array>
+#include <deque>
 #include <format>
 #include <iostream>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 
 namespace Freya {
+    namespace {
+        // Maximum number of service exits handled after a single wait
+        constexpr size_t EXIT_EVENT_BUFFER_SIZE = 16;
+
+        auto millis_since(const std::chrono::steady_clock::time_point begin,
+                          const std::chrono::steady_clock::time_point end) -> long long {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count();
+        }
+    } // namespace
+
     auto ServiceStarter::split(const std::string& s, char delim) -> std::vector<std::string> {
         std::stringstream        ss(s);
         std::string              item;
@@ -32,46 +46,151 @@ namespace Freya {
         return elems;
     }
 
+    void ServiceStarter::print_critical_path(ServiceRegistry&                    registry,
+                                             const std::vector<std::string>&     sorted_services,
+                                             const std::vector<ServiceProgress>& progress,
+                                             const Clock::time_point             boot_start) {
+        std::unordered_map<std::string, size_t> index;
+        for (size_t i = 0; i < sorted_services.size(); ++i) index[sorted_services[i]] = i;
+
+        // The critical path ends with the service that was ready last and continues with the
+        // dependency that was ready last
+        std::vector<size_t> path;
+        bool                has_last = false;
+        size_t              last     = 0;
+        for (size_t i = 0; i < progress.size(); ++i) {
+            if (progress[i].done && (!has_last || progress[i].ready > progress[last].ready)) {
+                last     = i;
+                has_last = true;
+            }
+        }
+        while (has_last) {
+            path.push_back(last);
+            has_last = false;
+            for (auto& dependency : registry[sorted_services[path.back()]].dependencies) {
+                const size_t d = index[dependency];
+                if (progress[d].done && (!has_last || progress[d].ready > progress[last].ready)) {
+                    last     = d;
+                    has_last = true;
+                }
+            }
+        }
+        if (path.empty()) return;
+
+        std::cout << std::format("Critical path ({} ms)",
+                                 millis_since(boot_start, progress[path.front()].ready))
+                  << std::endl;
+        for (auto it = path.rbegin(); it != path.rend(); ++it) {
+            std::cout << std::format("  {:<64}+{} ms -> +{} ms",
+                                     sorted_services[*it],
+                                     millis_since(boot_start, progress[*it].start),
+                                     millis_since(boot_start, progress[*it].ready))
+                      << std::endl;
+        }
+    }
+
     auto ServiceStarter::start_services(ServiceRegistry&                registry, // NOLINT
                                         const std::vector<std::string>& sorted_services) -> int {
-        bool mandatory_service_crashed = false;
-        std::cout << "Start services" << std::endl;
-        for (auto service_name : sorted_services) {
-            auto service = registry[service_name];
-            auto args    = split(service.exec_start, ' ');
-
-            const char* argv[args.size()]; // NOLINT
-            for (size_t i = 1; i < args.size(); ++i) argv[i - 1] = args[i].c_str();
-            argv[args.size() - 1]      = nullptr;
-            Ember::StdIOConfig inherit = {.target = Ember::StdIOTarget::INHERIT};
-            Ember::StatusCode  st =
-                Forge::app_start(args[0].c_str(), argv, "/", inherit, inherit, inherit);
-            if (st < Ember::Status::OKAY) {
-                std::cout << std::format("  {:<64}\033[38;2;205;49;49mFAILED ({})\033[0m",
-                                         service_name,
-                                         Ember::Status(st).to_string())
-                          << std::endl;
-                if (service.mandatory) break;
-                continue;
+        std::vector<ServiceProgress>            progress(sorted_services.size());
+        std::unordered_map<std::string, size_t> index;
+        for (size_t i = 0; i < sorted_services.size(); ++i) index[sorted_services[i]] = i;
+        std::deque<size_t> ready_queue;
+        for (size_t i = 0; i < sorted_services.size(); ++i) {
+            for (auto& dependency : registry[sorted_services[i]].dependencies) {
+                progress[index[dependency]].dependents.push_back(i);
+                progress[i].pending_dependencies++;
             }
+            if (progress[i].pending_dependencies == 0) ready_queue.push_back(i);
+        }
+
+        // Without a wait set Freya falls back to joining each service after its start
+        WaitSet    exit_wait_set;
+        const bool wait_concurrently = exit_wait_set.create() >= Ember::Status::OKAY;
+
+        bool                                          mandatory_service_crashed = false;
+        std::unordered_map<Ember::ResourceID, size_t> running; // App ID -> Service index
+        const Clock::time_point                       boot_start = Clock::now();
+
+        // A failed service that is not mandatory is done as well, so its dependents still start
+        auto mark_done = [&](const size_t i) {
+            progress[i].ready = Clock::now();
+            progress[i].done  = true;
+            for (size_t d : progress[i].dependents)
+                if (--progress[d].pending_dependencies == 0) ready_queue.push_back(d);
+        };
+        auto fail = [&](const size_t i, const std::string& reason) {
+            std::cout << std::format("  {:<64}\033[38;2;205;49;49mFAILED ({})\033[0m",
+                                     sorted_services[i],
+                                     reason)
+                      << std::endl;
+            if (registry[sorted_services[i]].mandatory)
+                mandatory_service_crashed = true;
+            else
+                mark_done(i);
+        };
+        auto succeed = [&](const size_t i) {
+            mark_done(i);
+            std::cout << std::format("  {:<64}\033[38;2;13;188;121mOKAY\033[0m (+{} ms -> +{} ms)",
+                                     sorted_services[i],
+                                     millis_since(boot_start, progress[i].start),
+                                     millis_since(boot_start, progress[i].ready))
+                      << std::endl;
+        };
+        auto verify_exit = [&](const size_t i, const int exit_code) {
+            if (exit_code != registry[sorted_services[i]].expected_exit_code)
+                fail(i, "WRONG_EXIT_CODE");
+            else
+                succeed(i);
+        };
+
+        std::cout << "Start services" << std::endl;
+        while (!mandatory_service_crashed) {
+            while (!ready_queue.empty() && !mandatory_service_crashed) {
+                const size_t i = ready_queue.front();
+                ready_queue.pop_front();
+                auto service = registry[sorted_services[i]];
+                auto args    = split(service.exec_start, ' ');
 
-            if (service.wait_for_exit) {
-                int service_exit_code = Forge::app_join(st);
-                if (service_exit_code != service.expected_exit_code) {
-                    std::cout << std::format(
-                        "  {:<64}\033[38;2;205;49;49mFAILED (WRONG_EXIT_CODE)\033[0m",
-                        service_name,
-                        Ember::Status(st).to_string())
-                              << std::endl;
-                    if (service.mandatory) {
-                        mandatory_service_crashed = true;
-                        break;
-                    }
+                const char* argv[args.size()]; // NOLINT
+                for (size_t j = 1; j < args.size(); ++j) argv[j - 1] = args[j].c_str();
+                argv[args.size() - 1]      = nullptr;
+                Ember::StdIOConfig inherit = {.target = Ember::StdIOTarget::INHERIT};
+                progress[i].start          = Clock::now();
+                Ember::StatusCode st =
+                    Forge::app_start(args[0].c_str(), argv, "/", inherit, inherit, inherit);
+                if (st < Ember::Status::OKAY) {
+                    fail(i, Ember::Status(st).to_string());
+                    continue;
                 }
+
+                if (!service.wait_for_exit)
+                    succeed(i);
+                else if (wait_concurrently
+                         && exit_wait_set.add_app_exit(st, i) >= Ember::Status::OKAY)
+                    running[st] = i;
+                else
+                    verify_exit(i, Forge::app_join(st));
+            }
+            if (mandatory_service_crashed || running.empty()) break;
+
+            std::array<Ember::WaitEvent, EXIT_EVENT_BUFFER_SIZE> exit_events;
+            const Ember::StatusCode count =
+                exit_wait_set.wait(exit_events.data(), exit_events.size());
+            if (count < Ember::Status::OKAY) {
+                // Waiting is broken -> Join the remaining services one by one
+                for (auto& [app_ID, i] : running) verify_exit(i, Forge::app_join(app_ID));
+                running.clear();
+                continue;
+            }
+            for (Ember::StatusCode e = 0; e < count; ++e) {
+                const Ember::WaitEvent& event = exit_events[e];
+                exit_wait_set.remove_app_exit(event.resource);
+                running.erase(event.resource);
+                verify_exit(event.user_data, event.result);
             }
-            std::cout << std::format("  {:<64}\033[38;2;13;188;121mOKAY\033[0m", service_name)
-                      << std::endl;
         }
+
+        print_critical_path(registry, sorted_services, progress, boot_start);
         return mandatory_service_crashed ? ExitCode::MANDATORY_SERVICE_CRASHED
                                          : ExitCode::SERVICES_STARTED;
     }
@@ -0,0 +1,111 @@
+/*
+ *  Copyright 2025 Ewogijk
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef CP_IORING_H
+#define CP_IORING_H
+
+#include <Ember/Ember.h>
+#include <Ember/SystemCall.h>
+#include <Ember/SystemCallID.h>
+#include <Ember/VFSBits.h>
+
+#include <array>
+
+/**
+ * @brief An IO ring with EntryCount entries that lets the kernel process a batch of VFS operations
+ * with a single system call.
+ *
+ * The kernel keeps the address of the ring after setup(), therefore a ring cannot be copied or
+ * moved.
+ *
+ * @tparam EntryCount Number of submission and completion queue entries, a power of two.
+ */
+template <U32 EntryCount> class IORing {
+    static_assert(EntryCount > 0 && (EntryCount & (EntryCount - 1)) == 0,
+                  "The IO ring entry count must be a power of two.");
+    static_assert(EntryCount <= Ember::IO_RING_ENTRY_LIMIT, "The IO ring has too many entries.");
+
+    std::array<Ember::IORingSubmission, EntryCount> _submissions{};
+    std::array<Ember::IORingCompletion, EntryCount> _completions{};
+    Ember::IORing                                   _ring{};
+
+  public:
+    IORing() = default;
+
+    ~IORing() = default;
+
+    IORing(const IORing&)                    = delete;
+    IORing(IORing&&)                         = delete;
+    auto operator=(const IORing&) -> IORing& = delete;
+    auto operator=(IORing&&) -> IORing&      = delete;
+
+    /**
+     * @brief Register the ring with the kernel.
+     * @return OKAY: The ring can be used, BAD_ARG: The kernel rejected the ring.
+     */
+    auto setup() -> Ember::StatusCode {
+        _ring.submissions = _submissions.data();
+        _ring.completions = _completions.data();
+        _ring.entry_count = EntryCount;
+        return Ember::system_call(Ember::VFS::IO_RING_SETUP, reinterpret_cast<U64>(&_ring));
+    }
+
+    /**
+     * @brief Append an operation to the submission queue, it is processed on the next enter().
+     * @param op        VFS operation.
+     * @param arg1      First argument of the operation.
+     * @param arg2      Second argument of the operation.
+     * @param arg3      Third argument of the operation.
+     * @param user_data Passed unchanged to the completion of the operation.
+     * @return True: The operation is queued, False: The submission queue is full.
+     */
+    auto submit(const Ember::IORingOp op,
+                const U64             arg1,
+                const U64             arg2,
+                const U64             arg3,
+                const U64             user_data) -> bool {
+        if (_ring.sq_tail - _ring.sq_head == EntryCount) return false;
+        _submissions[_ring.sq_tail & (EntryCount - 1)] = {.user_data = user_data,
+                                                          .arg1      = arg1,
+                                                          .arg2      = arg2,
+                                                          .arg3      = arg3,
+                                                          .op        = op.to_value()};
+        _ring.sq_tail++;
+        return true;
+    }
+
+    /**
+     * @brief Let the kernel process all queued operations.
+     * @return >= 0: Number of processed operations, < 0: The ring is not registered.
+     */
+    auto enter() -> Ember::StatusCode {
+        return Ember::system_call(Ember::VFS::IO_RING_ENTER, _ring.sq_tail - _ring.sq_head);
+    }
+
+    /**
+     * @brief Take the next completion from the completion queue.
+     * @param out The completion if the queue is not empty.
+     * @return True: A completion was taken, False: The completion queue is empty.
+     */
+    auto next_completion(Ember::IORingCompletion& out) -> bool {
+        if (_ring.cq_head == _ring.cq_tail) return false;
+        out = _completions[_ring.cq_head & (EntryCount - 1)];
+        _ring.cq_head++;
+        return true;
+    }
+};
+
+#endif // CP_IORING_H
@@ -16,6 +16,8 @@
 
 #include <Forge/VFS.h>
 
+#include "IORing.h"
+
 #include <array>
 #include <iostream>
 #include <sstream>
@@ -23,6 +25,13 @@
 #include <vector>
 
 constexpr U16 BUF_SIZE = 4096;
+// Number of blocks that are read or written with a single system call
+constexpr U32 BATCH_SIZE = 16;
+
+// A file is copied in batches of blocks, each batch is read into the buffers with one IO ring
+// system call and then written with another one
+IORing<BATCH_SIZE>                               IO_RING;    // NOLINT
+std::array<std::array<U8, BUF_SIZE>, BATCH_SIZE> BATCH_BUFS; // NOLINT
 
 auto str_split(const std::string& s, const char delimiter) -> std::vector<std::string> {
     std::vector<std::string> tokens;
@@ -162,13 +171,65 @@ auto copy_file_content(const std::string& src, const std::string& dest) -> bool
     const Ember::StatusCode dest_file_ID = open_node(dest_node, Ember::IOMode::WRITE);
     if (dest_file_ID < Ember::Status::OKAY) return false;
 
-    std::array<U8, BUF_SIZE> buf{};
-    Ember::StatusCode        bytes_read = Forge::vfs_read(src_file_ID, buf.data(), BUF_SIZE);
-    while (bytes_read > 0) {
-        if (const Ember::StatusCode bytes_written =
-                Forge::vfs_write(dest_file_ID, buf.data(), BUF_SIZE);
-            bytes_written < 0) {
-            if (bytes_written == Ember::Status::NODE_IS_DIRECTORY) {
+    std::array<Ember::StatusCode, BATCH_SIZE> bytes_read{};
+    bool                                      eof = false;
+    while (!eof) {
+        // A buffer without a read completion must not be written again
+        bytes_read.fill(0);
+        // The reads are processed in order, so the batch continues where the last one ended
+        for (U32 i = 0; i < BATCH_SIZE; i++) {
+            IO_RING.submit(Ember::IORingOp::READ,
+                           src_file_ID,
+                           reinterpret_cast<U64>(BATCH_BUFS[i].data()),
+                           BUF_SIZE,
+                           i);
+        }
+        if (const Ember::StatusCode st = IO_RING.enter(); st < Ember::Status::OKAY) {
+            // No completions will arrive -> eof would never be reached
+            std::cerr << "'" << src << "': IO ring error " << st << "." << std::endl;
+            close_node(src_file_ID);
+            close_node(dest_file_ID);
+            return false;
+        }
+
+        Ember::IORingCompletion completion;
+        Ember::StatusCode       read_error = Ember::Status::OKAY;
+        while (IO_RING.next_completion(completion)) {
+            bytes_read[completion.user_data] = completion.status;
+            if (completion.status < Ember::Status::OKAY) read_error = completion.status;
+            if (completion.status < BUF_SIZE) eof = true;
+        }
+        if (read_error < Ember::Status::OKAY) {
+            if (read_error == Ember::Status::NODE_IS_DIRECTORY) {
+                std::cerr << "'" << src << "': Not a file." << std::endl;
+            } else {
+                std::cerr << "'" << src << "': IO Error." << std::endl;
+            }
+            close_node(src_file_ID);
+            close_node(dest_file_ID);
+            return false;
+        }
+
+        for (U32 i = 0; i < BATCH_SIZE; i++) {
+            if (bytes_read[i] <= 0) continue;
+            IO_RING.submit(Ember::IORingOp::WRITE,
+                           dest_file_ID,
+                           reinterpret_cast<U64>(BATCH_BUFS[i].data()),
+                           bytes_read[i],
+                           i);
+        }
+        if (const Ember::StatusCode st = IO_RING.enter(); st < Ember::Status::OKAY) {
+            std::cerr << "'" << dest_node << "': IO ring error " << st << "." << std::endl;
+            close_node(src_file_ID);
+            close_node(dest_file_ID);
+            return false;
+        }
+
+        Ember::StatusCode write_error = Ember::Status::OKAY;
+        while (IO_RING.next_completion(completion))
+            if (completion.status < Ember::Status::OKAY) write_error = completion.status;
+        if (write_error < Ember::Status::OKAY) {
+            if (write_error == Ember::Status::NODE_IS_DIRECTORY) {
                 std::cerr << "'" << dest_node << "': Not a file." << std::endl;
             } else {
                 std::cerr << "'" << dest_node << "': IO Error." << std::endl;
@@ -177,18 +238,10 @@ auto copy_file_content(const std::string& src, const std::string& dest) -> bool
             close_node(dest_file_ID);
             return false;
         }
-        bytes_read = Forge::vfs_read(src_file_ID, buf.data(), BUF_SIZE);
-    }
-    if (bytes_read < 0) {
-        if (bytes_read == Ember::Status::NODE_IS_DIRECTORY) {
-            std::cerr << "'" << src << "': Not a file." << std::endl;
-        } else {
-            std::cerr << "'" << src << "': IO Error." << std::endl;
-        }
     }
     close_node(src_file_ID);
     close_node(dest_file_ID);
-    return bytes_read >= 0;
+    return true;
 }
 
 void close_dir_stream(const S64 dir_stream_ID) {
@@ -259,6 +312,11 @@ auto main(const int argc, char* argv[]) -> int {
         return 0;
     }
 
+    if (IO_RING.setup() < Ember::Status::OKAY) {
+        std::cerr << "Failed to set up the IO ring." << std::endl;
+        return -1;
+    }
+
     Ember::NodeInfo node_info;
     if (const int ret = get_node_info(args.src_path, node_info); ret < 1) {
         if (ret == 0) std::cerr << "'" << args.src_path << "': Node not found." << std::endl;
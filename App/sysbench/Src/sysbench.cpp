@@ -0,0 +1,202 @@
+/*
+ *  Copyright 2025 Ewogijk
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <Ember/Ember.h>
+#include <Ember/SystemCall.h>
+#include <Ember/SystemCallID.h>
+
+#include <Forge/App.h>
+#include <Forge/VFS.h>
+
+#include <array>
+#include <climits>
+#include <iostream>
+#include <string>
+
+constexpr size_t DEFAULT_ITERATIONS       = 100000;
+constexpr size_t DEFAULT_START_ITERATIONS = 20;
+
+// First argument of an app started by the start benchmark, the second argument is the timestamp
+// counter value before the app was started
+constexpr const char* START_PROBE = "--start-probe";
+
+struct CLIArgs {
+    size_t iterations = 0; // 0 -> Default of the benchmark
+
+    bool start = false;
+    bool help  = false;
+};
+
+auto parse_cli_args(const int argc, char* argv[], CLIArgs& args_out) -> bool { // NOLINT
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg.empty()) continue;
+
+        if (arg == "-h") {
+            args_out.help = true;
+        } else if (arg == "-s") {
+            args_out.start = true;
+        } else if (arg == "-n") {
+            if (i + 1 >= argc) {
+                std::cerr << "Missing iteration count after '-n'." << std::endl;
+                return false;
+            }
+            std::string count = argv[++i];
+            size_t      n     = 0;
+            for (char c : count) {
+                if (c < '0' || c > '9') {
+                    std::cerr << "'" << count << "' - Not a number." << std::endl;
+                    return false;
+                }
+                n = n * 10 + (c - '0');
+            }
+            if (n == 0) {
+                std::cerr << "The iteration count must be greater than zero." << std::endl;
+                return false;
+            }
+            args_out.iterations = n;
+        } else {
+            std::cerr << "Unknown argument '" << arg << "'" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+auto read_tsc() -> U64 {
+    U32 low  = 0;
+    U32 high = 0;
+    asm volatile("rdtsc" : "=a"(low), "=d"(high));
+    return static_cast<U64>(high) << 32 | low;
+}
+
+/**
+ * @brief Start the app as start probe and wait until it has exited.
+ * @param executable Path to the app.
+ * @param cold       True: Change the node version of the executable before the app is started, so
+ *                   the kernel cannot use its cached ELF image and segments.
+ * @return Cycles from the start of the app until its main function was called or a negative
+ *          status code if the app could not be started.
+ */
+auto measure_start(const char* executable, const bool cold) -> int {
+    if (cold) {
+        // Closing a node that was opened for writing invalidates everything the kernel cached
+        // about it, nothing is written so the content stays the same
+        const Ember::StatusCode node_ID = Forge::vfs_open(executable, Ember::IOMode::APPEND);
+        if (node_ID < Ember::Status::OKAY) return node_ID;
+        Forge::vfs_close(node_ID);
+    }
+
+    const std::string  start = std::to_string(read_tsc());
+    const char*        argv[] = {START_PROBE, start.c_str(), nullptr};
+    Ember::StdIOConfig inherit{.target = Ember::StdIOTarget::INHERIT};
+    const Ember::StatusCode app_ID =
+        Forge::app_start(executable, argv, "/", inherit, inherit, inherit);
+    if (app_ID < Ember::Status::OKAY) return app_ID;
+    return Forge::app_join(app_ID);
+}
+
+/**
+ * @brief Measure the start-to-main latency of the sysbench app, each cold start is followed by a
+ * warm start.
+ * @param executable Path to the sysbench app.
+ * @param iterations Number of cold and warm starts.
+ * @return 0: The benchmark completed, -1: An app start failed.
+ */
+auto run_start_benchmark(const char* executable, const size_t iterations) -> int {
+    // Index 0: Cold starts, index 1: Warm starts
+    std::array<U64, 2> total = {0, 0};
+    std::array<U64, 2> min   = {static_cast<U64>(-1), static_cast<U64>(-1)};
+    for (size_t i = 0; i < iterations; i++) {
+        for (int warm = 0; warm < 2; warm++) {
+            const int cycles = measure_start(executable, warm == 0);
+            if (cycles < 0) {
+                std::cerr << "Failed to start \"" << executable << "\": " << cycles << std::endl;
+                return -1;
+            }
+            total[warm] += cycles;
+            if (static_cast<U64>(cycles) < min[warm]) min[warm] = cycles;
+        }
+    }
+
+    std::cout << "App starts:       " << iterations << " cold, " << iterations << " warm"
+              << std::endl;
+    std::cout << "Cold avg cycles:  " << total[0] / iterations << std::endl;
+    std::cout << "Cold min cycles:  " << min[0] << std::endl;
+    std::cout << "Warm avg cycles:  " << total[1] / iterations << std::endl;
+    std::cout << "Warm min cycles:  " << min[1] << std::endl;
+    return 0;
+}
+
+auto main(const int argc, char* argv[]) -> int {
+    // Read the timestamp counter first, so the start benchmark measures as little as possible of
+    // main itself
+    const U64 main_tsc = read_tsc();
+    if (argc == 3 && std::string(argv[1]) == START_PROBE) {
+        const U64 cycles = main_tsc - std::stoull(argv[2]);
+        return cycles > INT_MAX ? INT_MAX : static_cast<int>(cycles);
+    }
+
+    CLIArgs args;
+    if (!parse_cli_args(argc, argv, args)) return -1;
+
+    if (args.help) {
+        std::cout << "sysbench [options]" << std::endl;
+        std::cout << "    Measure the round trip time of a system call." << std::endl;
+        std::cout << "Options:" << std::endl;
+        std::cout << "    -n <count>: Number of system calls to make, default is "
+                  << DEFAULT_ITERATIONS << "." << std::endl;
+        std::cout << "    -s:         Measure the start-to-main latency of an app instead, with"
+                  << std::endl;
+        std::cout << "                cold and warm executable caches. -n is the number of app"
+                  << std::endl;
+        std::cout << "                starts, default is " << DEFAULT_START_ITERATIONS << "."
+                  << std::endl;
+        std::cout << "    -h:         Print this help menu." << std::endl;
+        return 0;
+    }
+
+    // The kernel passes the app path as first argument
+    if (args.start)
+        return run_start_benchmark(argv[0],
+                                   args.iterations > 0 ? args.iterations
+                                                       : DEFAULT_START_ITERATIONS);
+    if (args.iterations == 0) args.iterations = DEFAULT_ITERATIONS;
+
+    // GET_PAGE_SIZE does no work in the kernel, so the measurement is dominated by the system call
+    // entry, dispatch and exit
+    const Ember::ResourceID sys_call_id = Ember::Memory::GET_PAGE_SIZE;
+    if (Ember::system_call(sys_call_id) < Ember::Status::OKAY) {
+        std::cerr << "System call " << sys_call_id << " failed." << std::endl;
+        return -1;
+    }
+
+    U64 min_cycles = static_cast<U64>(-1);
+    U64 start      = read_tsc();
+    for (size_t i = 0; i < args.iterations; i++) {
+        U64 call_start = read_tsc();
+        Ember::system_call(sys_call_id);
+        U64 call_cycles = read_tsc() - call_start;
+        if (call_cycles < min_cycles) min_cycles = call_cycles;
+    }
+    U64 total_cycles = read_tsc() - start;
+
+    std::cout << "System calls: " << args.iterations << std::endl;
+    std::cout << "Total cycles: " << total_cycles << std::endl;
+    std::cout << "Avg cycles:   " << total_cycles / args.iterations << std::endl;
+    std::cout << "Min cycles:   " << min_cycles << std::endl;
+    return 0;
+}
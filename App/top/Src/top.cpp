@@ -0,0 +1,218 @@
+/*
+ *  Copyright 2025 Ewogijk
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <Ember/AppBits.h>
+#include <Ember/Ember.h>
+#include <Ember/SystemCall.h>
+#include <Ember/SystemCallID.h>
+
+#include <Forge/App.h>
+
+#include <algorithm>
+#include <array>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+constexpr size_t MAX_APPS           = 64;
+constexpr U64    SAMPLE_INTERVAL_MS = 1000;
+
+struct CLIArgs {
+    size_t samples = 0; // 0 -> Sample until a key is pressed
+
+    bool help = false;
+};
+
+/// @brief An app and its CPU usage during the last sample interval.
+struct AppSample {
+    Ember::AppResourceUsage usage;
+    U64                     cycles = 0; // User and kernel cycles since the last sample
+};
+
+auto parse_cli_args(const int argc, char* argv[], CLIArgs& args_out) -> bool { // NOLINT
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg.empty()) continue;
+
+        if (arg == "-h") {
+            args_out.help = true;
+        } else if (arg == "-n") {
+            if (i + 1 >= argc) {
+                std::cerr << "Missing sample count after '-n'." << std::endl;
+                return false;
+            }
+            std::string count = argv[++i];
+            size_t      n     = 0;
+            for (char c : count) {
+                if (c < '0' || c > '9') {
+                    std::cerr << "'" << count << "' - Not a number." << std::endl;
+                    return false;
+                }
+                n = n * 10 + (c - '0');
+            }
+            if (n == 0) {
+                std::cerr << "The sample count must be greater than zero." << std::endl;
+                return false;
+            }
+            args_out.samples = n;
+        } else {
+            std::cerr << "Unknown argument '" << arg << "'" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+auto read_tsc() -> U64 {
+    U32 low  = 0;
+    U32 high = 0;
+    asm volatile("rdtsc" : "=a"(low), "=d"(high));
+    return static_cast<U64>(high) << 32 | low;
+}
+
+/**
+ * @brief Read the resource usage of all apps and compute the cycles every app used since the
+ * last sample.
+ * @param last_cycles Cycles of each app at the last sample, updated with the new sample.
+ * @param samples_out The apps sorted by the cycles they used.
+ * @return True: The resource usage was read, False: The system call failed.
+ */
+auto sample_apps(std::unordered_map<Ember::ResourceID, U64>& last_cycles,
+                 std::vector<AppSample>&                     samples_out) -> bool {
+    std::array<Ember::AppResourceUsage, MAX_APPS> usage_buf;
+
+    const Ember::StatusCode count = Ember::system_call(Ember::App::READ_RESOURCE_USAGE,
+                                                     reinterpret_cast<U64>(usage_buf.data()),
+                                                     usage_buf.size());
+    if (count < Ember::Status::OKAY) {
+        std::cerr << "Failed to read the resource usage: " << count << std::endl;
+        return false;
+    }
+
+    std::unordered_map<Ember::ResourceID, U64> cycles;
+    samples_out.clear();
+    for (int i = 0; i < count; i++) {
+        const Ember::AppResourceUsage& usage = usage_buf[i];
+        const U64                      total = usage.user_cycles + usage.kernel_cycles;
+        // An app that is new since the last sample has used all of its cycles in this interval
+        const auto last = last_cycles.find(usage.app_handle);
+        samples_out.push_back(
+            {.usage = usage, .cycles = last == last_cycles.end() ? total : total - last->second});
+        cycles[usage.app_handle] = total;
+    }
+    last_cycles = std::move(cycles);
+
+    std::ranges::sort(samples_out, [](const AppSample& a, const AppSample& b) {
+        return a.cycles > b.cycles;
+    });
+    return true;
+}
+
+void print_samples(const std::vector<AppSample>& samples, const U64 interval_cycles) {
+    std::cout << std::left << std::setw(24) << "ID-Name" << std::right << std::setw(8) << "%CPU"
+              << std::setw(8) << "Threads" << std::setw(10) << "Heap" << std::setw(10) << "Peak"
+              << std::setw(12) << "Read" << std::setw(12) << "Written" << std::setw(12)
+              << "Syscalls" << std::endl;
+    for (const AppSample& s : samples) {
+        const std::string id_name = std::to_string(s.usage.app_handle) + "-" + s.usage.name;
+        // Keep one decimal place without floating point formatting
+        const U64 permille = interval_cycles == 0 ? 0 : s.cycles * 1000 / interval_cycles;
+        const std::string cpu =
+            std::to_string(permille / 10) + "." + std::to_string(permille % 10);
+        std::cout << std::left << std::setw(24) << id_name << std::right << std::setw(8) << cpu
+                  << std::setw(8) << s.usage.thread_count << std::setw(10)
+                  << s.usage.heap_pages << std::setw(10) << s.usage.peak_heap_pages
+                  << std::setw(12) << s.usage.bytes_read << std::setw(12)
+                  << s.usage.bytes_written << std::setw(12) << s.usage.system_call_count
+                  << std::endl;
+    }
+    std::cout << std::endl;
+}
+
+/**
+ * @brief Block until the sample interval is over or a key was pressed.
+ * @param wait_set Handle of a wait set that watches stdin.
+ * @return 0: The interval is over, 1: A key was pressed, <0: The wait failed.
+ */
+auto wait_for_interval(const Ember::ResourceID wait_set) -> Ember::StatusCode {
+    Ember::WaitEvent        event;
+    const Ember::StatusCode count = Ember::system_call(Ember::App::WAIT_SET_WAIT,
+                                                     wait_set,
+                                                     reinterpret_cast<U64>(&event),
+                                                     1,
+                                                     SAMPLE_INTERVAL_MS);
+    if (count <= 0) return count;
+    // Consume the key, stdin events are level-triggered
+    Forge::app_read_stdin();
+    return 1;
+}
+
+auto main(const int argc, char* argv[]) -> int {
+    CLIArgs args;
+    if (!parse_cli_args(argc, argv, args)) return -1;
+    if (args.help) {
+        std::cout << "top [-n count] [-h]" << std::endl << std::endl;
+        std::cout << "Print the CPU time, memory and IO of all apps every second, CPU time is the "
+                     "share of TSC cycles of the sample interval. Press any key to quit."
+                  << std::endl
+                  << std::endl;
+        std::cout << "Options:" << std::endl;
+        std::cout << "    -n count - Stop after count samples." << std::endl;
+        std::cout << "    -h       - Print this help message." << std::endl;
+        return 0;
+    }
+
+    const Ember::StatusCode wait_set = Ember::system_call(Ember::App::WAIT_SET_CREATE);
+    if (wait_set < Ember::Status::OKAY) {
+        std::cerr << "Failed to create a wait set: " << wait_set << std::endl;
+        return -1;
+    }
+    if (const Ember::StatusCode st =
+            Ember::system_call(Ember::App::WAIT_SET_ADD, wait_set, Ember::WaitEventType::STDIN_KEY);
+        st < Ember::Status::OKAY) {
+        std::cerr << "Failed to watch stdin: " << st << std::endl;
+        Ember::system_call(Ember::App::WAIT_SET_FREE, wait_set);
+        return -1;
+    }
+
+    std::unordered_map<Ember::ResourceID, U64> last_cycles;
+    std::vector<AppSample>                     samples;
+    // The first sample only sets the baseline
+    int exit_code = sample_apps(last_cycles, samples) ? 0 : -1;
+    U64 last_tsc  = read_tsc();
+    for (size_t i = 0; exit_code == 0 && (args.samples == 0 || i < args.samples); i++) {
+        const Ember::StatusCode st = wait_for_interval(wait_set);
+        if (st < Ember::Status::OKAY) {
+            std::cerr << "Failed to wait for the sample interval: " << st << std::endl;
+            exit_code = -1;
+            break;
+        }
+        if (st > 0) break;
+
+        const U64 now = read_tsc();
+        if (!sample_apps(last_cycles, samples)) {
+            exit_code = -1;
+            break;
+        }
+        print_samples(samples, now - last_tsc);
+        last_tsc = now;
+    }
+
+    Ember::system_call(Ember::App::WAIT_SET_FREE, wait_set);
+    return exit_code;
+}
@@ -25,8 +25,16 @@
 
 #include <KRE/Collections/LinkedList.h>
 
+#include <Ember/AppBits.h>
+
 #include <CPU/CPU.h>
 
+#include <CPU/Interrupt/InterruptLock.h>
+
+#include <CPU/Threading/WaitSet.h>
+
+#include <App/SegmentCache.h>
+
 #include <VirtualFileSystem/Path.h>
 #include <VirtualFileSystem/VFSModule.h>
 
@@ -47,6 +55,33 @@ namespace Rune::App {
      */
     DECLARE_ENUM(LoadStatus, LOAD_STATUSES, 0x0) // NOLINT
 
+    /**
+     * @brief Resource usage counters of an app, the CPU time and system calls of running threads
+     * are counted by the threads and added when a thread exits.
+     */
+    struct ResourceUsage {
+        U64 user_cycles       = 0; // CPU time of exited threads in TSC cycles
+        U64 kernel_cycles     = 0;
+        U64 system_call_count = 0; // System calls of exited threads
+        U64 heap_pages        = 0; // Pages mapped through the memory system calls
+        U64 peak_heap_pages   = 0;
+        U64 bytes_read        = 0; // Bytes read from nodes
+        U64 bytes_written     = 0; // Bytes written to nodes
+
+        /**
+         * @brief Count newly mapped heap pages and update the peak.
+         * @param pages
+         */
+        void add_heap_pages(U64 pages);
+
+        /**
+         * @brief Count unmapped heap pages. ELF segments and thread stacks are not heap pages and
+         * are never counted.
+         * @param pages
+         */
+        void remove_heap_pages(U64 pages);
+    };
+
     /**
      * General information and used system resources of an app.
      */
@@ -89,6 +124,16 @@ namespace Rune::App {
          */
         int exit_code = INT_MAX;
 
+        /**
+         * @brief True when the app has exited, the exit code is valid then.
+         */
+        bool has_exited = false;
+
+        /**
+         * @brief Woken when the app exits, wait sets watch it to wait for the exit of the app.
+         */
+        CPU::WaitQueue exit_wait_queue;
+
         //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
         //                                  Resources / resource tables
         //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -97,12 +142,35 @@ namespace Rune::App {
         PhysicalAddr base_page_table_address = 0x0;
         VirtualAddr  entry                   = 0x0;
 
+        /**
+         * @brief Kernel mapping of the kernel info page of the app, the app sees it read-only.
+         */
+        Ember::KernelInfo* kernel_info = nullptr;
+
         /**
          * @brief Application heap
          */
         VirtualAddr heap_start = 0x0;
         VirtualAddr heap_limit = 0x0;
 
+        /**
+         * @brief Lowest address of the thread stacks, they are allocated top-down below the kernel
+         * info area. The stacks of exited threads are reused.
+         */
+        VirtualAddr             thread_stack_limit = 0x0;
+        LinkedList<VirtualAddr> free_thread_stacks;
+
+        /**
+         * @brief Read-only ELF segments that are shared with other apps, they must be unmapped
+         * before the address space is freed.
+         */
+        LinkedList<SharedPointer<SharedSegment>> shared_segments;
+
+        /**
+         * @brief CPU time, memory and IO used by the app.
+         */
+        ResourceUsage usage;
+
         /**
          * Running threads of the app
          */
@@ -124,6 +192,22 @@ namespace Rune::App {
          */
         LinkedList<U16> directory_stream_table;
 
+        /**
+         * @brief Address of the IO ring the app has registered, zero if it has none.
+         */
+        VirtualAddr io_ring = 0x0;
+
+        /**
+         * @brief All wait sets of the app.
+         */
+        HandleTable<CPU::WaitSet, U16> wait_set_table;
+
+        /**
+         * @brief Serializes pinning user buffers with freeing user memory, so a thread cannot free
+         * memory another thread of the app is about to pin.
+         */
+        CPU::InterruptSaveLock user_memory_lock;
+
         /**
          * @brief stdio streams.
          */
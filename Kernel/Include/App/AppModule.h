@@ -24,6 +24,8 @@
 #include <KRE/System/Module.h>
 
 #include <App/App.h>
+#include <App/ImageCache.h>
+#include <App/SegmentCache.h>
 
 #include <CPU/CPUModule.h>
 
@@ -66,13 +68,30 @@ namespace Rune::App {
         Device::DeviceModule* _dev_module;
         FrameBuffer           _frame_buffer;
 
-        HashMap<U16, SharedPointer<Info>> _app_table;
-        HandleCounter<U16>                _app_handle_counter;
+        HandleTable<Info, U16> _app_table;
 
-        SharedPointer<Info> _active_app;
+        // Owned by the app table, the app info struct of an exited app is only freed after its
+        // last thread has stopped and the active app was switched
+        Info* _active_app;
 
         U16 _system_loader_handle;
 
+        // Page frame of the kernel clock that is shared with all apps
+        PhysicalAddr _kernel_clock_frame;
+
+        // Parsed executables and read-only ELF segments of recently started executables
+        ImageCache   _image_cache;
+        SegmentCache _segment_cache;
+
+        // Interrupts must be disabled while the address space of a clone is loaded
+        CPU::InterruptLock _clone_lock;
+
+        // A new thread must not run before it is added to the thread table of its app
+        CPU::InterruptLock _thread_lock;
+
+        // User stack size of the threads an app starts, the page below each stack stays unmapped
+        static constexpr MemorySize THREAD_STACK_SIZE = 64 * MemoryUnit::KiB;
+
         /**
          * @brief Set the ID and working directory in the entry and schedule it's main thread for
          * execution.
@@ -83,6 +102,20 @@ namespace Rune::App {
                                 CPU::StartInfo*            start_info,
                                 const Path&                working_directory) -> int;
 
+        /**
+         * @brief Free the user space of the app, page frames the app only maps but does not own are
+         * unmapped and not freed.
+         * @param app
+         */
+        void free_user_space(Info* app);
+
+        /**
+         * @brief Allocate a thread stack in the address space of the active app, the stacks of
+         * exited threads are reused.
+         * @return Lowest address of the stack, 0x0 if no stack could be allocated.
+         */
+        auto allocate_thread_stack() -> VirtualAddr;
+
         auto setup_file_stream(const SharedPointer<Info>& app,
                                StdStream                  std_stream,
                                const Path&                file_path) -> SharedPointer<TextStream>;
@@ -140,6 +173,33 @@ namespace Rune::App {
          */
         [[nodiscard]] auto get_active_app() const -> Info*;
 
+        /**
+         * @brief Search the app table for the app with the handle.
+         * @param handle
+         * @return The app or a null pointer if no app has the handle.
+         */
+        [[nodiscard]] auto find_app(U16 handle) const -> SharedPointer<Info>;
+
+        /**
+         * The caller must hold the user memory lock of the active app until the range is freed,
+         * otherwise another thread could pin it after the check.
+         *
+         * @brief Check if another thread of the active app has pinned user memory in the range for
+         * its running system call, see SystemCall::KernelGuardian::pin_user_buffer().
+         * @param start Start of the user memory range.
+         * @param size  Size of the user memory range.
+         * @return True: The range must not be freed yet, False: The range can be freed.
+         */
+        [[nodiscard]] auto is_user_memory_pinned(VirtualAddr start, MemorySize size) const -> bool;
+
+        /**
+         * @brief Sum up the resources used by the app, the CPU time of the stopped threads is
+         *        included.
+         * @param app
+         * @return The resource usage of the app.
+         */
+        [[nodiscard]] auto get_resource_usage(const Info& app) const -> Ember::AppResourceUsage;
+
         /**
          * @brief Dump the app table to the stream.
          * @param stream
@@ -197,6 +257,62 @@ namespace Rune::App {
                            const Ember::StdIOConfig& stdout_config,
                            const Ember::StdIOConfig& stderr_config) -> StartStatus;
 
+        /**
+         * <p>
+         *  The address space of the active app is cloned copy-on-write, that is both apps share all
+         * page frames until one of them writes to a page, which then gets its own copy of the page.
+         * Therefore, the clone starts with the current memory state of the active app without
+         * loading anything from disk.
+         * </p>
+         *
+         * <p>
+         *  The clone inherits the working directory and the standard streams of the active app,
+         * open nodes, directory streams and wait sets are not inherited. Its main thread is passed
+         * a copy of the start info of the active app and runs on the stack below `stack_top`, e.g.
+         * just below the stack pointer of the calling thread.
+         * </p>
+         *
+         * @brief Start a copy-on-write clone of the active app whose main thread runs the entry
+         * function.
+         * @param entry     Main function of the clone.
+         * @param stack_top Initial stack pointer of the main thread of the clone.
+         *
+         * @return The final start status of the clone. If (LoadStatus == Running) then ID will
+         * contain the assigned app ID, otherwise the app ID is -1.
+         */
+        auto clone_active_app(CPU::ThreadMain entry, VirtualAddr stack_top) -> StartStatus;
+
+        /**
+         * <p>
+         *  The thread runs in the address space of the active app on its own user stack, which is
+         * allocated below the kernel info area of the app. It is passed a copy of the start info of
+         * the main thread with argc = 1 and argv = {arg, nullptr}, the argument is not interpreted
+         * by the kernel.
+         * </p>
+         *
+         * @brief Start a new thread in the active app.
+         * @param entry Main function of the thread.
+         * @param arg   Argument of the thread.
+         * @return Handle of the thread, 0 if the thread could not be started.
+         */
+        auto start_thread(CPU::ThreadMain entry, void* arg) -> U16;
+
+        /**
+         * If the running thread is the main thread of the active app, the app exits instead.
+         *
+         * @brief Free the user stack of the running thread and terminate it.
+         * @param exit_code Exit code of the thread.
+         */
+        void exit_running_thread(int exit_code);
+
+        /**
+         * @brief Block the calling thread until a thread of the active app has exited.
+         * @param handle Handle of a thread.
+         * @return True: The thread has exited, False: The thread is not a running thread of the
+         * active app or it is the calling thread.
+         */
+        auto join_thread(U16 handle) -> bool;
+
         /**
          * @brief free all app resources and exit the main thread with the provided exit code.
          *
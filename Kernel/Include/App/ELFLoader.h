@@ -19,6 +19,8 @@
 
 #include <App/App.h>
 #include <App/ELF.h>
+#include <App/ImageCache.h>
+#include <App/SegmentCache.h>
 
 #include <Memory/MemoryModule.h>
 
@@ -40,6 +42,9 @@ namespace Rune::App {
 
         // File content buffering
         static constexpr U16 BUF_SIZE = 8192;
+
+        // Kernel info page + kernel clock page below the user stack
+        static constexpr U8 KERNEL_INFO_AREA_PAGES = 2;
         U16                  _buf_pos{0};
         U16                  _buf_limit{0};
         Array<U8, BUF_SIZE>  _file_buf;
@@ -47,6 +52,13 @@ namespace Rune::App {
         Memory::MemoryModule* _memory_subsys;
         VFS::VFSModule*       _vfs_subsys;
 
+        // Page frame of the kernel clock, it is mapped into every app
+        PhysicalAddr _kernel_clock_frame;
+
+        // Parsed executables and read-only segments that are shared between apps
+        ImageCache*   _image_cache;
+        SegmentCache* _segment_cache;
+
         // Open ELF file
         SharedPointer<VFS::Node> _elf_file;
 
@@ -67,16 +79,73 @@ namespace Rune::App {
 
         auto load_elf_file(ELF64File& elf_file) -> LoadStatus;
 
+        /**
+         * @brief Check if a segment is mapped from the segment cache instead of being loaded.
+         *
+         * <p>
+         *  Read-only LOAD segments are shared unless one of their pages is also used by another
+         * LOAD segment, since a shared page frame must not contain any private data.
+         * </p>
+         *
+         * @param elf_file
+         * @param ph_idx   Index of the program header.
+         * @return True: The segment is shared, False: The segment is private to the app.
+         */
+        [[nodiscard]] auto is_shared_segment(const ELF64File& elf_file, size_t ph_idx) const
+            -> bool;
+
         auto allocate_segments(const ELF64File& elf64_file, VirtualAddr& heap_start) -> bool;
 
-        auto load_segments(const ELF64File& elf_file) -> bool;
+        /**
+         * @brief Copy the content of a segment from the executable into the page frames of a
+         * shared segment and zero the rest of the page frames.
+         * @param ph
+         * @param segment
+         * @return True: The segment is filled, False: The executable could not be read.
+         */
+        auto fill_shared_segment(const ELF64ProgramHeader& ph, const SharedSegment& segment)
+            -> bool;
+
+        /**
+         * @brief Map a read-only segment from the segment cache, the segment is loaded into the
+         * cache if it is not cached.
+         * @param ph
+         * @param executable
+         * @param version    VFS node version of the executable.
+         * @param entry_out  The mapped segment is added to the shared segments of the app.
+         * @return True: The segment is mapped, False: The segment could not be loaded or mapped.
+         */
+        auto map_shared_segment(const ELF64ProgramHeader&  ph,
+                                const Path&                executable,
+                                U64                        version,
+                                const SharedPointer<Info>& entry_out) -> bool;
+
+        auto load_segments(const ELF64File&           elf_file,
+                           const Path&                executable,
+                           U64                        version,
+                           const SharedPointer<Info>& entry_out) -> bool;
+
+        /**
+         * @brief Map a new kernel info page and the kernel clock page read-only into the current
+         * address space.
+         * @param kernel_info_begin Virtual address of the kernel info page, the kernel clock page
+         * is mapped directly after it.
+         * @return Kernel mapping of the kernel info page or a nullptr if the pages could not be
+         * mapped.
+         */
+        auto setup_kernel_info_area(VirtualAddr kernel_info_begin) -> Ember::KernelInfo*;
 
-        auto setup_bootstrap_area(const ELF64File& elf_file,
-                                  char*            args[], // NOLINT argv is part of the kernel ABI
-                                  size_t           stack_size) -> CPU::StartInfo*;
+        auto setup_bootstrap_area(const ELF64File&    elf_file,
+                                  char*               args[], // NOLINT argv is part of the ABI
+                                  size_t              stack_size,
+                                  Ember::KernelInfo*& kernel_info_out) -> CPU::StartInfo*;
 
       public:
-        ELFLoader(Memory::MemoryModule* memory_module, VFS::VFSModule* vfs_subsys);
+        ELFLoader(Memory::MemoryModule* memory_module,
+                  VFS::VFSModule*       vfs_subsys,
+                  PhysicalAddr          kernel_clock_frame,
+                  ImageCache*           image_cache,
+                  SegmentCache*         segment_cache);
 
         /**
          * Try to parse and verify the given executable file, load it's segments into memory and
@@ -92,7 +161,8 @@ namespace Rune::App {
          * a Note PH (presence is optional)</li> <li>Virtual Address Space Allocation: Remember the
          * virtual address space (VAS) of the currently running app, then create a new VAS for the
          * new app and load it.</li> <li>Load PH's in memory: Allocate writable pages for each PH,
-         * copy PH content to memory and lastly modify page flags based on SegmentPermissions</li>
+         * copy PH content to memory and lastly modify page flags based on SegmentPermissions.
+         * Read-only segments are mapped from the segment cache instead.</li>
          *   <li>Parse vendor information (if available): Get the Vendor from the name part of the
          * Note PH and the app version from the desc part.</li> <li>Fill App table entry: Put the
          * executable path, app name (filename without extension), vendor, major, minor patch
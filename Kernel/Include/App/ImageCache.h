@@ -0,0 +1,81 @@
+/*
+ *  Copyright 2025 Ewogijk
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef RUNEOS_IMAGECACHE_H
+#define RUNEOS_IMAGECACHE_H
+
+#include <KRE/Collections/LinkedList.h>
+
+#include <App/ELF.h>
+
+#include <VirtualFileSystem/Path.h>
+
+namespace Rune::App {
+
+    /**
+     * @brief A bounded cache of the verified ELF headers, program headers and vendor information
+     * of recently started executables.
+     *
+     * <p>
+     *  An image is identified by the executable path and the VFS node version of the executable.
+     * Writing or deleting the executable changes its node version, so a stale image is never
+     * found again and is replaced by the next image of the same executable. At most CAPACITY
+     * images are cached, the least recently used image is evicted when a new image is inserted
+     * into a full cache.
+     * </p>
+     */
+    class ImageCache {
+        static constexpr size_t CAPACITY = 16;
+
+        struct Image {
+            Path      executable;
+            U64       version = 0; // VFS node version of the executable
+            ELF64File elf_file;
+        };
+
+        LinkedList<Image> _images; // Most recently used first
+
+        size_t _hit_count;
+        size_t _miss_count;
+
+      public:
+        ImageCache();
+
+        /**
+         * @brief Search the image of an executable and mark it as most recently used.
+         * @param executable
+         * @param version    VFS node version of the executable.
+         * @param out        A copy of the cached image, if it was found.
+         * @return True: The image was found, False: The image is not cached.
+         */
+        auto find(const Path& executable, U64 version, ELF64File& out) -> bool;
+
+        /**
+         * @brief Insert the image of an executable as most recently used, older images of the
+         * executable are removed.
+         * @param executable
+         * @param version    VFS node version of the executable.
+         * @param elf_file   Verified image of the executable.
+         */
+        void insert(const Path& executable, U64 version, const ELF64File& elf_file);
+
+        [[nodiscard]] auto get_hit_count() const -> size_t;
+
+        [[nodiscard]] auto get_miss_count() const -> size_t;
+    };
+} // namespace Rune::App
+
+#endif // RUNEOS_IMAGECACHE_H
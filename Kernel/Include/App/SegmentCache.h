@@ -0,0 +1,148 @@
+/*
+ *  Copyright 2025 Ewogijk
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef RUNEOS_SEGMENTCACHE_H
+#define RUNEOS_SEGMENTCACHE_H
+
+#include <KRE/Memory.h>
+
+#include <KRE/Collections/LinkedList.h>
+
+#include <Memory/Paging.h>
+#include <Memory/PhysicalMemoryManager.h>
+
+#include <VirtualFileSystem/Path.h>
+
+namespace Rune::App {
+
+    /**
+     * @brief The page frames of a read-only LOAD segment of an executable.
+     *
+     * <p>
+     *  The frames are filled once and then mapped read-only into every app that runs the same
+     * version of the executable. They are freed when the last reference to the segment is dropped,
+     * that is when the segment was evicted from the segment cache and all apps mapping it have
+     * exited.
+     * </p>
+     */
+    class SharedSegment {
+        Memory::PhysicalMemoryManager* _pmm;
+        PhysicalAddr*                  _frames;
+        size_t                         _page_count;
+        size_t                         _allocated_count; // Number of frames that were allocated
+
+      public:
+        const Path        executable;
+        const U64         version;       // VFS node version of the executable
+        const U64         file_offset;   // Offset of the segment in the executable
+        const VirtualAddr virtual_start; // Page aligned start of the segment
+
+        SharedSegment(Memory::PhysicalMemoryManager* pmm,
+                      const Path&                    executable,
+                      U64                            version,
+                      U64                            file_offset,
+                      VirtualAddr                    virtual_start,
+                      size_t                         page_count);
+
+        ~SharedSegment();
+
+        SharedSegment(const SharedSegment&)                    = delete;
+        SharedSegment(SharedSegment&&)                         = delete;
+        auto operator=(const SharedSegment&) -> SharedSegment& = delete;
+        auto operator=(SharedSegment&&) -> SharedSegment&      = delete;
+
+        /**
+         * @brief
+         * @return True: All page frames of the segment were allocated.
+         */
+        [[nodiscard]] auto is_allocated() const -> bool;
+
+        [[nodiscard]] auto get_page_count() const -> size_t;
+
+        /**
+         * @brief Get the kernel mapping of a page frame, it is used to fill the frame.
+         * @param page_idx
+         * @return Pointer to the page frame in the higher half direct map.
+         */
+        [[nodiscard]] auto get_page(size_t page_idx) const -> U8*;
+
+        /**
+         * @brief Map all page frames of the segment to virtual_start.
+         * @param base_pt Base page table of the app.
+         * @param flags   Page flags.
+         * @return True: All pages are mapped, False: No page is mapped.
+         */
+        auto map(const Memory::PageTable& base_pt, U16 flags) -> bool;
+
+        /**
+         * @brief Unmap all pages of the segment without freeing the page frames.
+         * @param base_pt Base page table of the app.
+         */
+        void unmap(const Memory::PageTable& base_pt);
+    };
+
+    /**
+     * @brief A bounded cache of the read-only LOAD segments of recently started executables.
+     *
+     * <p>
+     *  Segments are identified by the executable path, the VFS node version of the executable and
+     * the file offset of the segment. Writing or deleting the executable changes its node
+     * version, so stale segments are never found again and age out of the cache.
+     * </p>
+     * <p>
+     *  At most CAPACITY segments are cached. When a new segment is inserted into a full cache, the
+     * least recently used segment that is not mapped by any app is evicted, if all segments are
+     * mapped the least recently used segment is evicted. An evicted segment stays mapped in the
+     * apps using it.
+     * </p>
+     */
+    class SegmentCache {
+        static constexpr size_t CAPACITY = 32;
+
+        LinkedList<SharedPointer<SharedSegment>> _segments; // Most recently used first
+
+        size_t _hit_count;
+        size_t _miss_count;
+
+        void evict();
+
+      public:
+        SegmentCache();
+
+        /**
+         * @brief Search a cached segment and mark it as most recently used.
+         * @param executable
+         * @param version     VFS node version of the executable.
+         * @param file_offset Offset of the segment in the executable.
+         * @return The cached segment or a null pointer if it is not cached.
+         */
+        auto find(const Path& executable, U64 version, U64 file_offset)
+            -> SharedPointer<SharedSegment>;
+
+        /**
+         * @brief Insert a filled segment as most recently used, a segment is evicted if the cache
+         * is full.
+         * @param segment
+         */
+        void insert(const SharedPointer<SharedSegment>& segment);
+
+        [[nodiscard]] auto get_hit_count() const -> size_t;
+
+        [[nodiscard]] auto get_miss_count() const -> size_t;
+    };
+} // namespace Rune::App
+
+#endif // RUNEOS_SEGMENTCACHE_H
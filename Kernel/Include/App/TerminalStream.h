@@ -146,6 +146,13 @@ namespace Rune::App {
         //      ...
         int viewport = 0;
 
+        // True: A batch of text is written, lines below the screen and the cursor are rendered
+        // once the batch is done instead of after every character
+        bool defer_rendering = false;
+
+        // True: The screen no longer shows the lines in the viewport and must be redrawn
+        bool screen_outdated = false;
+
         //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
         //                                    Cursor Renderer Settings
         //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -239,12 +246,27 @@ namespace Rune::App {
          */
         void scroll_back_buffer_append_new_line();
 
+        /**
+         * @brief Move the cursor to the beginning of a new line and scroll the screen if the cursor
+         * moved below it.
+         */
+        void new_line();
+
         //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
         //                                          Render Functions
         //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 
         void scroll_back(int lines);
 
+        // Render the lines [begin, end) of the scroll back buffer at their position on the screen
+        void render_lines(int begin, int end);
+
+        // Clear the screen and render all lines in the viewport
+        void redraw_screen();
+
+        // Render everything that was deferred during a batch write
+        void render_deferred();
+
         // Draw the char and advance the cursor
         void draw_char(char ch);
 
@@ -299,6 +321,19 @@ namespace Rune::App {
          */
         auto interpret_char(char ch) -> bool;
 
+        /**
+         * @brief Interpret the char and render it if it is not part of an ANSI escape sequence. The
+         * caller must hold the terminal mutex.
+         * @param ch
+         */
+        void put_char(char ch);
+
+        /**
+         * @brief Start the cursor render thread if it is not running yet.
+         * @return True: The terminal is initialized, False: It is not.
+         */
+        auto start_render_thread() -> bool;
+
       public:
         TerminalStream(CPU::CPUModule* cpu_module,
                        FrameBuffer*    frame_buffer,
@@ -316,6 +351,18 @@ namespace Rune::App {
 
         auto write(U8 value) -> bool override;
 
+        /**
+         * @brief Write the whole buffer while holding the terminal lock once.
+         *
+         * Scrolling and the cursor are rendered once after the last character instead of after
+         * every character, lines that scrolled out of the screen during the batch are never drawn.
+         *
+         * @param buffer
+         * @param size
+         * @return The number of bytes written.
+         */
+        auto write_buffer(const char* buffer, size_t size) -> size_t override;
+
         void flush() override;
 
         void close() override;
@@ -228,6 +228,12 @@ namespace Rune::CPU {
      */
     CLINK auto get_page_fault_address() -> Register;
 
+    /**
+     * @brief Read the time stamp counter of the CPU core, it is incremented every CPU cycle.
+     * @return The current value of the time stamp counter.
+     */
+    CLINK auto read_timestamp_counter() -> U64;
+
 } // namespace Rune::CPU
 
 #endif // RUNEOS_CPU_H
@@ -50,6 +50,7 @@ namespace Rune::CPU {
     /// - THREAD_PREEMPTED: A context switch is about to happen.
     ///                     Event Context - Thread*: The next thread that will be scheduled.
     DECLARE_ENUM(EventHook, CPU_EVENT_HOOKS, 0x0) // NOLINT
+    CPU_EVENT_HOOKS(ASSERT_EVENT_HOOK_FITS)
 
     /// @brief Event context of the "THREAD_STOPPED" event hook.
     struct ThreadPreemptionContext {
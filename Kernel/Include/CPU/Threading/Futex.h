@@ -0,0 +1,110 @@
+/*
+ *  Copyright 2025 Ewogijk
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+#ifndef RUNEOS_FUTEX_H
+#define RUNEOS_FUTEX_H
+
+#include <KRE/Memory.h>
+
+#include <KRE/Collections/Array.h>
+#include <KRE/Collections/LinkedList.h>
+
+#include <Ember/Enum.h>
+
+#include <CPU/Interrupt/InterruptLock.h>
+#include <CPU/Threading/Scheduler.h>
+#include <CPU/Time/Timer.h>
+
+namespace Rune::CPU {
+#define FUTEX_WAIT_STATUSES(X)                                                                     \
+    X(FutexWaitStatus, WOKEN, 0x1)                                                                 \
+    X(FutexWaitStatus, VALUE_CHANGED, 0x2)                                                         \
+    X(FutexWaitStatus, TIMED_OUT, 0x3)
+
+    /// @brief The result of a futex wait.
+    ///
+    /// WOKEN: The thread was woken by a futex wake.<br>
+    /// VALUE_CHANGED: The futex did not have the expected value, the thread did not wait.<br>
+    /// TIMED_OUT: The timeout expired before the thread was woken.<br>
+    DECLARE_ENUM(FutexWaitStatus, FUTEX_WAIT_STATUSES, 0x0) // NOLINT
+
+    /// @brief The futex table lets threads wait for an integer in memory to change, so user mode
+    ///         locks only enter the kernel when they are contended.
+    ///
+    /// A futex is identified by the address space and the virtual address of the integer, threads
+    /// of the same app that share a futex therefore wait in the same queue. The waiting threads of
+    /// all futexes are distributed over a fixed number of hashed buckets, each with its own lock.
+    ///
+    /// The kernel never allocates anything per futex, a futex only exists while threads wait on it.
+    class FutexTable {
+        static constexpr size_t BUCKET_COUNT = 64;
+
+        struct Waiter {
+            PhysicalAddr          address_space = 0;
+            VirtualAddr           address       = 0;
+            SharedPointer<Thread> thread;
+            bool                  is_woken      = false;
+        };
+
+        struct Bucket {
+            InterruptSaveLock                 lock;
+            LinkedList<SharedPointer<Waiter>> waiters;
+        };
+
+        Array<Bucket, BUCKET_COUNT> _buckets;
+
+        auto get_bucket(PhysicalAddr address_space, VirtualAddr address) -> Bucket&;
+
+      public:
+        FutexTable() = default;
+
+        FutexTable(const FutexTable&)                    = delete;
+        FutexTable(FutexTable&&)                         = delete;
+        auto operator=(const FutexTable&) -> FutexTable& = delete;
+        auto operator=(FutexTable&&) -> FutexTable&      = delete;
+
+        /// @brief Block the calling thread until the futex is woken, if the futex still has the
+        ///         expected value.
+        ///
+        /// The value is compared while the bucket of the futex is locked, thus a wake up that
+        /// happens after the value was changed cannot be lost.
+        ///
+        /// @param futex         Pointer to the futex in the address space of the calling thread,
+        ///                       it must be accessible until the thread is woken.
+        /// @param expected      The thread only waits if the futex has this value.
+        /// @param timer         Timer that wakes the thread when the timeout expires.
+        /// @param timeout_nanos Ember::WAIT_FOREVER: Wait without a timeout, Else: Wait at most the
+        ///                       amount of nanoseconds.
+        /// @return The wait status.
+        auto wait(volatile int* futex, int expected, Timer* timer, U64 timeout_nanos)
+            -> FutexWaitStatus;
+
+        /// @brief Wake at most count threads waiting on the futex in FIFO order.
+        /// @param address_space Base page table address of the address space of the futex.
+        /// @param address       Virtual address of the futex.
+        /// @param count         Maximum number of threads to wake.
+        /// @return Number of threads that were blocked on the futex and are now woken.
+        auto wake(PhysicalAddr address_space, VirtualAddr address, size_t count) -> size_t;
+
+        /// @brief Remove all waiters of a stopped thread, so they are neither woken nor counted.
+        /// @param thread The stopped thread.
+        void remove_waiters(const SharedPointer<Thread>& thread);
+    };
+
+    /// @brief Kernel-wide futex table.
+    extern FutexTable g_futex_table;
+} // namespace Rune::CPU
+
+#endif // RUNEOS_FUTEX_H
@@ -0,0 +1,97 @@
+/*
+ *  Copyright 2025 Ewogijk
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef RUNEOS_KERNELSTACKALLOCATOR_H
+#define RUNEOS_KERNELSTACKALLOCATOR_H
+
+#include <KRE/Memory.h>
+
+#include <KRE/Collections/Array.h>
+
+#include <Memory/VirtualMemoryManager.h>
+
+#include <CPU/Interrupt/InterruptLock.h>
+#include <CPU/Threading/Thread.h>
+
+namespace Rune::CPU {
+
+    /// @brief The kernel stack allocator maps the kernel stacks of threads into a dedicated kernel
+    ///         region, instead of allocating them on the kernel heap.
+    ///
+    /// The region is divided into slots of one guard page followed by the pages of a kernel stack.
+    /// The guard page is never mapped, so a thread that overflows its kernel stack faults on the
+    /// guard page instead of silently overwriting the stack of another thread or heap objects.
+    ///
+    /// Freed stacks stay mapped in a small per-CPU cache and are handed out again by the next
+    /// allocation on the same CPU, so creating and destroying threads in quick succession neither
+    /// takes the global lock nor touches the page tables. Only when the cache of a CPU is full, a
+    /// freed stack is unmapped and its slot is returned to the region.
+    class KernelStackAllocator {
+        static constexpr U8 CPU_CACHE_LIMIT = 8; // Number of CPUs with a free stack cache
+        static constexpr U8 CPU_CACHE_SIZE  = 8; // Number of cached free stacks per CPU
+
+        struct FreeStackCache {
+            InterruptSaveLock          lock;
+            Array<U8*, CPU_CACHE_SIZE> stacks;
+            U8                         count = 0;
+        };
+
+        Memory::VirtualMemoryManager* _vmm;
+        VirtualAddr                   _region_start;
+        size_t                        _slot_size; // Guard page + kernel stack
+
+        // Indices of all slots that are not mapped
+        InterruptSaveLock _slot_lock;
+        U32*              _free_slots;
+        U32               _free_slot_count;
+
+        Array<FreeStackCache, CPU_CACHE_LIMIT> _cpu_caches;
+
+        auto get_cpu_cache() -> FreeStackCache*;
+
+      public:
+        KernelStackAllocator();
+
+        ~KernelStackAllocator();
+
+        KernelStackAllocator(const KernelStackAllocator&)                    = delete;
+        KernelStackAllocator(KernelStackAllocator&&)                         = delete;
+        auto operator=(const KernelStackAllocator&) -> KernelStackAllocator& = delete;
+        auto operator=(KernelStackAllocator&&) -> KernelStackAllocator&      = delete;
+
+        /// @brief Divide the kernel stack region into stack slots.
+        /// @param vmm    Virtual memory manager.
+        /// @param region The kernel stack region, its page tables must be shared by all address
+        ///                spaces.
+        /// @return True: The allocator is ready, False: The region is too small for a single
+        ///          stack.
+        auto init(Memory::VirtualMemoryManager* vmm, const MemoryRegion& region) -> bool;
+
+        /// @brief Allocate a kernel stack of Thread::KERNEL_STACK_SIZE bytes.
+        /// @return Bottom of the kernel stack or a nullptr if all slots are used or the stack
+        ///          could not be mapped.
+        auto allocate() -> U8*;
+
+        /// @brief Free a kernel stack, nothing happens if it is a nullptr.
+        /// @param stack_bottom Bottom of the kernel stack.
+        void free(U8* stack_bottom);
+    };
+
+    /// @brief Kernel-wide kernel stack allocator.
+    extern KernelStackAllocator g_kernel_stack_allocator;
+} // namespace Rune::CPU
+
+#endif // RUNEOS_KERNELSTACKALLOCATOR_H
@@ -21,6 +21,7 @@
 
 #include <CPU/Threading/Scheduler.h>
 #include <CPU/Threading/Spinlock.h>
+#include <CPU/Threading/WaitQueue.h>
 
 namespace Rune::CPU {
     /// @brief A fair lock-free non-recursive mutex.
@@ -33,6 +34,7 @@ namespace Rune::CPU {
         SharedPointer<Thread>             _owner;
         Spinlock                          _wait_queue_lock;
         LinkedList<SharedPointer<Thread>> _wait_queue;
+        WaitQueue                         _unlock_wait_queue;
 
         /// @brief Trace the owner and wait queue upon an action e.g. lock.
         /// @param action
@@ -54,6 +56,13 @@ namespace Rune::CPU {
         /// @return A list of threads waiting for the mutex to be unlocked.
         [[nodiscard]] auto get_waiting_threads() const -> LinkedList<Thread*>;
 
+        /// @brief Get the wait queue that is woken when the mutex is unlocked and has no new owner.
+        ///
+        /// Threads must not wait on the queue directly, they should only watch it, e.g. with a
+        /// wait set. lock() is the only way to wait for the mutex.
+        /// @return The unlock wait queue.
+        auto get_unlock_wait_queue() -> WaitQueue*;
+
         /// @brief Try to lock the mutex, if it is already locked the calling thread will be
         ///         blocked.
         ///
@@ -54,7 +54,8 @@ namespace Rune::CPU {
 
         /// @brief Allocate the kernel stacks for the given stack.
         /// @param thread
-        void setup_kernel_stack(const SharedPointer<Thread>& thread);
+        /// @return True: The kernel stack is set up, False: No kernel stack is available.
+        auto setup_kernel_stack(const SharedPointer<Thread>& thread) -> bool;
 
         /**
          * @brief Search for the next thread that should be scheduled.
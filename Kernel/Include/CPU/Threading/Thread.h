@@ -16,12 +16,19 @@
 #ifndef RUNEOS_THREAD_H
 #define RUNEOS_THREAD_H
 
+#include <Ember/AppBits.h>
 #include <Ember/Ember.h>
 
 #include <KRE/System/Resource.h>
 
+namespace Rune::App {
+    struct Info;
+} // namespace Rune::App
+
 namespace Rune::CPU {
     struct StartInfo;
+    class WaitQueue;
+    class WaitSet;
 
     /// @brief Main function of a thread. It has the signature int(StartInfo*). The start
     /// info contains argc/argv parameters as well as other information. The return value is the
@@ -136,6 +143,11 @@ namespace Rune::CPU {
          * @brief Address of a 16 byte random value.
          */
         void* random;
+
+        /**
+         * @brief Address of the read-only kernel info page of the app.
+         */
+        const Ember::KernelInfo* kernel_info;
     };
 
     /// @brief The thread struct contains technical and informational data about a thread object.
@@ -156,15 +168,32 @@ namespace Rune::CPU {
 
         Thread(MutexHandle handle, const String& name);
 
+        /// @brief Threads are allocated from a dedicated object cache instead of a general purpose
+        ///         cache, so creating a thread reuses the memory of a terminated one.
+        /// @param size
+        /// @return Memory for a thread or a nullptr if the kernel heap is exhausted.
+        static auto operator new(size_t size) noexcept -> void*;
+
+        static void operator delete(void* thread);
+
+        /// @brief Add the cycles since the accounting mark to the user or kernel time of the
+        ///         thread and move the mark to now.
+        /// @param now Current TSC value.
+        void account_cycles(U64 now);
+
         // Handle of the app the thread belongs to
         U16              app_handle = 0;
         ThreadState      state      = ThreadState::CREATED;
         SchedulingPolicy policy     = SchedulingPolicy::NONE;
 
+        /// @brief The app the thread belongs to, it is set by the app module so the active app can
+        ///         be switched without searching the app table.
+        App::Info* app = nullptr;
+
         /// @brief The kernel stack is used whenever kernel code is run e.g. because of an interrupt
-        ///         or syscall It is dynamically allocated on the kernel heap and has a
+        ///         or syscall It is allocated by the kernel stack allocator and has a
         ///         preconfigured fixed size
-        U8*         kernel_stack_bottom = nullptr; // Pointer to the heap allocated memory
+        U8*         kernel_stack_bottom = nullptr; // Lowest address of the kernel stack
         VirtualAddr kernel_stack_top    = 0x0;
 
         /// @brief The user mode stack contains application data, it is managed by an application.
@@ -181,6 +210,29 @@ namespace Rune::CPU {
         ///         specific TLS register.
         void* thread_control_block = nullptr;
 
+        //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+        //                                  CPU Time Accounting
+        //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+
+        /// @brief CPU time in TSC cycles, time spent in system calls and all time of kernel
+        ///         threads is kernel time.
+        U64 user_cycles   = 0;
+        U64 kernel_cycles = 0;
+
+        /// @brief Number of system calls the thread has made.
+        U64 system_call_count = 0;
+
+        /// @brief TSC value when the CPU time of the thread was last accounted.
+        U64 accounting_mark = 0;
+
+        /// @brief True while the thread is handling a system call.
+        bool in_system_call = false;
+
+        /// @brief User memory covering all buffers the running system call has pinned, the app
+        ///         must not free it until the system call returns. Empty if start equals end.
+        VirtualAddr pinned_user_memory_start = 0x0;
+        VirtualAddr pinned_user_memory_end   = 0x0;
+
         //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
         //                                  Resource Refs
         //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -194,6 +246,12 @@ namespace Rune::CPU {
         /// @brief Handle of the semaphore that maintains the thread.
         SemaphoreHandle semaphore_handle = Resource<SemaphoreHandle>::HANDLE_NONE;
 
+        /// @brief Wait queue that maintains the thread.
+        WaitQueue* wait_queue = nullptr;
+
+        /// @brief Wait set that maintains the thread.
+        WaitSet* wait_set = nullptr;
+
         /// @brief Handle of the thread that this thread is waiting for to exit.
         ThreadHandle m_sync_stop_thread_handle = Resource<ThreadHandle>::HANDLE_NONE;
 
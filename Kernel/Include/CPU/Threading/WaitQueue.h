@@ -0,0 +1,82 @@
+/*
+ *  Copyright 2025 Ewogijk
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+#ifndef RUNEOS_WAITQUEUE_H
+#define RUNEOS_WAITQUEUE_H
+
+#include <KRE/Collections/LinkedList.h>
+#include <KRE/Utility.h>
+
+#include <CPU/Interrupt/InterruptLock.h>
+#include <CPU/Threading/Scheduler.h>
+
+namespace Rune::CPU {
+    /// @brief A watcher is notified every time a wait queue is woken, this allows a thread to wait
+    ///         for many wait queues at once, e.g. with a wait set.
+    class WaitQueueWatcher {
+      public:
+        virtual ~WaitQueueWatcher() = default;
+
+        /// @brief Called when the watched wait queue is woken, this can happen in an IRQ handler.
+        /// @return True: A woken thread is the next thread to run, False: Otherwise.
+        virtual auto notify() -> bool = 0;
+    };
+
+    /// @brief A wait queue blocks threads until an event happens, e.g. a device has new data.
+    ///
+    /// The wait queue is safe to use from IRQ handlers: The condition of a waiting thread is
+    /// checked with interrupts disabled, so an IRQ handler cannot signal the event between the
+    /// check and the moment the thread is put into the wait queue.
+    class WaitQueue {
+        InterruptSaveLock                 _lock;
+        LinkedList<SharedPointer<Thread>> _waiters;
+        LinkedList<WaitQueueWatcher*>     _watchers;
+
+      public:
+        WaitQueue() = default;
+
+        WaitQueue(const WaitQueue&)                    = delete;
+        WaitQueue(WaitQueue&&)                         = delete;
+        auto operator=(const WaitQueue&) -> WaitQueue& = delete;
+        auto operator=(WaitQueue&&) -> WaitQueue&      = delete;
+
+        /// @brief
+        /// @return A list of threads waiting in the queue.
+        [[nodiscard]] auto get_waiting_threads() const -> LinkedList<Thread*>;
+
+        /// @brief Block the calling thread until it is woken, unless the event already happened.
+        /// @param has_happened Returns true if the event the thread waits for already happened.
+        void wait(const Function<bool()>& has_happened);
+
+        /// @brief Notify the watcher whenever the wait queue is woken until it is removed.
+        /// @param watcher
+        void add_watcher(WaitQueueWatcher* watcher);
+
+        /// @brief Stop notifying the watcher.
+        /// @param watcher
+        void remove_watcher(WaitQueueWatcher* watcher);
+
+        /// @brief Unblock all waiting threads and notify all watchers.
+        /// @return True: A woken thread is the next thread to run, an IRQ handler should preempt
+        ///          the running thread, False: Otherwise.
+        auto wake_all() -> bool;
+
+        /// @brief Remove a stopped thread from the waiting threads.
+        /// @param thread
+        void remove_waiter(const SharedPointer<Thread>& thread);
+    };
+} // namespace Rune::CPU
+
+#endif // RUNEOS_WAITQUEUE_H
@@ -0,0 +1,146 @@
+/*
+ *  Copyright 2025 Ewogijk
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+#ifndef RUNEOS_WAITSET_H
+#define RUNEOS_WAITSET_H
+
+#include <KRE/Memory.h>
+#include <KRE/Utility.h>
+
+#include <KRE/Collections/LinkedList.h>
+
+#include <Ember/AppBits.h>
+
+#include <CPU/Interrupt/InterruptLock.h>
+#include <CPU/Threading/WaitQueue.h>
+#include <CPU/Time/Timer.h>
+
+namespace Rune::CPU {
+    /// @brief A wait set lets a thread wait for many events at once, e.g. stdin, app exits and
+    ///         unlocked mutexes.
+    ///
+    /// Each entry of the wait set watches the wait queue of its event source. When the wait queue
+    /// is woken, the entry is appended to the ready list of the wait set and the waiting thread is
+    /// unblocked. A wait only polls the entries in the ready list, so its cost depends on the
+    /// number of ready events and not on the number of entries.
+    ///
+    /// Events are level-triggered: A ready entry is reported again by the next wait until it is
+    /// no longer ready. Reported entries are moved to the end of the ready list, so no entry is
+    /// starved when more events are ready than a single wait returns.
+    ///
+    /// Only a single thread can wait on a wait set at a time.
+    class WaitSet {
+        /// @brief An event the wait set waits for.
+        class Entry : public WaitQueueWatcher {
+          public:
+            WaitSet*   wait_set;
+            WaitQueue* source;
+            // Returns true if the event is ready and sets the event specific result
+            Function<bool(int&)> poll;
+            Ember::WaitEvent     event;
+            Entry*               next_ready = nullptr;
+            bool                 is_queued  = false;
+
+            Entry(WaitSet* wait_set, WaitQueue* source, Function<bool(int&)> poll);
+
+            auto notify() -> bool override;
+        };
+
+        U16 _handle;
+
+        InterruptSaveLock                _lock;
+        LinkedList<SharedPointer<Entry>> _entries;
+        Entry*                           _ready_head;
+        Entry*                           _ready_tail;
+        SharedPointer<Thread>            _waiter;
+
+        /// @brief Append the entry to the ready list, the wait set must be locked.
+        /// @param entry
+        void queue_ready(Entry* entry);
+
+        /// @brief Remove the entry from the ready list, the wait set must be locked.
+        /// @param entry
+        void dequeue_ready(Entry* entry);
+
+        /// @brief Poll all entries in the ready list once and report the ready events, the wait set
+        ///         must be locked.
+        ///
+        /// Entries that are no longer ready are removed from the ready list.
+        ///
+        /// @param events Receives the ready events.
+        /// @param size   Maximum number of events.
+        /// @return Number of ready events.
+        auto collect(Ember::WaitEvent* events, size_t size) -> size_t;
+
+        /// @brief Queue the entry as ready and wake the waiting thread.
+        /// @param entry
+        /// @return True: The waiting thread is the next thread to run, False: Otherwise.
+        auto signal(Entry* entry) -> bool;
+
+      public:
+        explicit WaitSet(U16 handle);
+
+        ~WaitSet();
+
+        WaitSet(const WaitSet&)                    = delete;
+        WaitSet(WaitSet&&)                         = delete;
+        auto operator=(const WaitSet&) -> WaitSet& = delete;
+        auto operator=(WaitSet&&) -> WaitSet&      = delete;
+
+        [[nodiscard]] auto get_handle() const -> U16;
+
+        /// @brief Add an event to the wait set.
+        ///
+        /// The poll function is called with interrupts disabled, it must not block and should
+        /// capture a reference to the event source, so that the source lives as long as the entry.
+        ///
+        /// @param type      Type of the event.
+        /// @param resource  Handle of the event source.
+        /// @param user_data Reported back with the event.
+        /// @param source    Wait queue that is woken when the event happens or a nullptr if the
+        ///                   event can only be polled, the entry is then polled by every wait.
+        /// @param poll      Returns true if the event is ready and sets the event specific result.
+        /// @return True: The event is added, False: The event is already in the wait set.
+        auto add(Ember::WaitEventType        type,
+                 U16                         resource,
+                 U64                         user_data,
+                 WaitQueue*                  source,
+                 const Function<bool(int&)>& poll) -> bool;
+
+        /// @brief Remove an event from the wait set.
+        /// @param type
+        /// @param resource
+        /// @return True: The event is removed, False: The event is not in the wait set.
+        auto remove(Ember::WaitEventType type, U16 resource) -> bool;
+
+        /// @brief Block the calling thread until at least one event is ready or the timeout
+        ///         expires.
+        /// @param events        Receives the ready events.
+        /// @param size          Maximum number of events.
+        /// @param timer         Timer that wakes the thread when the timeout expires.
+        /// @param timeout_nanos 0: Only poll the events, Ember::WAIT_FOREVER: Wait without a
+        ///                       timeout, Else: Wait at most the amount of nanoseconds.
+        /// @return -1: Another thread is already waiting, Else: Number of ready events, zero if
+        ///          the timeout expired.
+        auto wait(Ember::WaitEvent* events, size_t size, Timer* timer, U64 timeout_nanos) -> int;
+
+        /// @brief Remove a stopped thread that waits for events, so other threads can wait on the
+        ///         wait set again.
+        /// @param thread
+        void remove_waiter(const SharedPointer<Thread>& thread);
+    };
+} // namespace Rune::CPU
+
+#endif // RUNEOS_WAITSET_H
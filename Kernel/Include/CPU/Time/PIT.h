@@ -63,6 +63,8 @@ namespace Rune::CPU {
         auto remove_sleeping_thread(int t_id) -> bool override;
 
         void sleep_until(U64 wake_time_nanos) override;
+
+        auto schedule_wake_up(U64 wake_time_nanos) -> bool override;
     };
 
 } // namespace Rune::CPU
@@ -17,6 +17,8 @@
 #ifndef RUNEOS_TIMER_H
 #define RUNEOS_TIMER_H
 
+#include <Ember/AppBits.h>
+
 #include <KRE/Collections/LinkedList.h>
 
 #include <CPU/Threading/Scheduler.h>
@@ -57,6 +59,15 @@ namespace Rune::CPU {
 
         // Time in nanoseconds a thread can run before being preempted
         U64 _quantum; // NOLINT
+        // Kernel clock page that is mapped into all apps, nullptr until it is set
+        Ember::KernelClock* _kernel_clock; // NOLINT
+
+        /**
+         * @brief Publish the current time in the kernel clock page, timer drivers call this on
+         * every timer IRQ.
+         * @param tick_count Timer ticks since the timer was started.
+         */
+        void publish_kernel_clock(U64 tick_count);
 
       public:
         explicit Timer();
@@ -93,6 +104,12 @@ namespace Rune::CPU {
          */
         [[nodiscard]] virtual auto get_time_since_start() const -> U64 = 0;
 
+        /**
+         * @brief Set the kernel clock page, from now on it is updated on every timer tick.
+         * @param kernel_clock Kernel mapping of the kernel clock page.
+         */
+        void set_kernel_clock(Ember::KernelClock* kernel_clock);
+
         /**
          * @brief Get all threads that have been put to sleep by this timer.
          * @return A list of sleeping threads.
@@ -144,6 +161,20 @@ namespace Rune::CPU {
          */
         virtual void sleep_until(U64 wake_time_nanos) = 0;
 
+        /**
+         * @brief Wake the currently running thread at the specified wake time without putting it
+         * to sleep, the caller blocks the thread itself, e.g. to wait for other events at the same
+         * time.
+         *
+         * Interrupts must be disabled until the thread is marked as block pending, otherwise the
+         * wake up could be lost. A thread that is woken by another event must remove itself from
+         * the wait queue of the timer.
+         *
+         * @param wake_time_nanos Wake time in nanoseconds
+         * @return True: The wake up is scheduled, False: The wake time is in the past.
+         */
+        virtual auto schedule_wake_up(U64 wake_time_nanos) -> bool = 0;
+
         /**
          * @brief Put the currently running thread to sleep and wake it in the specified amount of
          * nanoseconds.
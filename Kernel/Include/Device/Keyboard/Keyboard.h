@@ -45,6 +45,12 @@ namespace Rune::Device {
          */
         auto read() -> int override = 0;
 
+        /**
+         * @brief Block the calling thread until a virtual key is in the buffer.
+         * @return True.
+         */
+        auto wait_for_input() -> bool override = 0;
+
         auto is_write_supported() -> bool override;
 
         auto write(U8 value) -> bool override;
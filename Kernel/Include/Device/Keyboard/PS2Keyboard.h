@@ -22,6 +22,7 @@
 #include <KRE/Collections/Array.h>
 
 #include <CPU/Interrupt/IRQ.h>
+#include <CPU/Threading/WaitQueue.h>
 
 namespace Rune::Device {
     /**
@@ -32,13 +33,16 @@ namespace Rune::Device {
         static constexpr U8     EXTENDED_BYTE    = 0xE0;
         static constexpr U8     DATA_REGISTER    = 0x60;
 
+        // Single producer (the IRQ handler), single consumer ring buffer, the IRQ handler only
+        // moves the end and readers only move the start, so no lock is needed
         Array<U16, RING_BUFFER_SIZE> _key_code_cache;
-        U8                           _start{0};
-        U8                           _end{0};
+        volatile int                 _start{0};
+        volatile int                 _end{0};
 
         bool _wait_key_e0{false};
 
         CPU::FastInterruptHandler _irq_handler;
+        CPU::WaitQueue            _readers;
 
       public:
         static const BasicDeviceID ID_PS2_KEYBOARD;
@@ -47,6 +51,12 @@ namespace Rune::Device {
 
         auto read() -> int override;
 
+        auto wait_for_input() -> bool override;
+
+        auto has_input() -> bool override;
+
+        auto get_input_wait_queue() -> CPU::WaitQueue* override;
+
         void flush() override;
 
         [[nodiscard]] auto vendor() const -> String override;
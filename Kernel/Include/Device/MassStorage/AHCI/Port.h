@@ -637,9 +637,12 @@ namespace Rune::Device {
      *
      * Memory region pointed to by CommandHeader.CTBA/CTBAU. Contains the Command FIS,
      * an optional ATAPI command, and the Physical Region Descriptor Table.
-     * Must be 128-byte aligned; this struct is padded to exactly 256 bytes.
+     * Must be 128-byte aligned; the PRDT fills this struct to exactly 256 bytes.
      */
     struct CommandTable {
+        /// Number of PRDT entries that fit in the 256 byte command table.
+        static constexpr U8 PRDT_ENTRY_COUNT = 8;
+
         /// Command FIS sent to the device (H2D Register FIS; up to 64 bytes; actual length from
         /// CommandHeader.CFL).
         RegisterHost2DeviceFIS CFIS;
@@ -652,9 +655,7 @@ namespace Rune::Device {
 
         /// Physical Region Descriptor Table; actual entry count given by CommandHeader.PRDTL. //
         /// NOLINT
-        Array<PRDTEntry, 1> PRDT;
-
-        Array<U8, 112> Reserved1; // Pad to 256 bytes to ensure 128-byte alignment. // NOLINT
+        Array<PRDTEntry, PRDT_ENTRY_COUNT> PRDT;
     };
 } // namespace Rune::Device
 
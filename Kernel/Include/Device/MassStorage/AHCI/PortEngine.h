@@ -97,8 +97,6 @@ namespace Rune::Device {
     };
 
     struct Request {
-        static constexpr MemorySize INTERNAL_BUF_SIZE = 8192;
-
         void*  buf      = nullptr;
         size_t buf_size = 0;
 
@@ -142,6 +140,27 @@ namespace Rune::Device {
                                const SharedPointer<MassStorageDevice>& physical_device,
                                const SharedPointer<PortEngine>&        port_engine);
 
+        /**
+         * A buffer with more pages than PRDT entries cannot be described by a single command, the
+         * maximum transfer size is chosen so that any buffer of that size fits regardless of its
+         * alignment.
+         *
+         * @brief
+         * @return Maximum number of bytes a single ATA command can transfer.
+         */
+        [[nodiscard]] auto max_transfer_size() const -> size_t;
+
+        /**
+         * The buffer is described page by page in the PRDT of the command, physically contiguous
+         * pages share a PRDT entry. The buffer must not be bigger than max_transfer_size() unless
+         * it is physically contiguous.
+         *
+         * @brief Issue an ATA command and wait until it has completed.
+         * @param buf     Buffer for the transferred data.
+         * @param bufSize Size of the buffer in bytes.
+         * @param h2dFis  The ATA command.
+         * @return Number of transferred bytes, 0 if the command failed.
+         */
         auto send_ata_command(void* buf, size_t bufSize, RegisterHost2DeviceFIS h2dFis) -> size_t;
     };
 
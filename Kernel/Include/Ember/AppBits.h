@@ -48,6 +48,19 @@ namespace Ember {
         char        argument[STRING_SIZE_LIMIT] = {}; // NOLINT
     };
 
+#define STDIN_READ_MODES(X)                                                                        \
+    X(StdinReadMode, BLOCKING, 0x1)                                                                \
+    X(StdinReadMode, NON_BLOCKING, 0x2)
+
+    /// @brief Describes how a batched stdin read waits for keys.
+    ///
+    /// BLOCKING: Wait until at least one key is available.<br>
+    /// NON_BLOCKING: Return immediately, even when no key is available. Use it to poll stdin.<br>
+    DECLARE_ENUM(StdinReadMode, STDIN_READ_MODES, 0x0) // NOLINT
+
+    /// @brief Maximum number of keys a single batched stdin read returns.
+    constexpr U16 STDIN_READ_KEY_LIMIT = 64;
+
     /**
      * @brief A virtual key on the virtual keyboard which defines the keyboard as a 2D matrix of
      * keys. Each key is defined by its keycode which is an 16-bit unsigned integer defined as
@@ -146,6 +159,128 @@ namespace Ember {
 
         friend auto operator!=(const VirtualKey& one, const VirtualKey& two) -> bool;
     };
+
+    /**
+     * @brief The kernel clock, a single page shared by all apps that the kernel updates on every
+     * timer tick.
+     *
+     * <p>
+     *  The clock is protected by a sequence lock: The kernel makes the sequence odd before it
+     * updates the clock and even again afterwards. A reader must retry when the sequence was odd
+     * or changed while it read the clock, read() does exactly that.
+     * </p>
+     */
+    struct KernelClock {
+        U32 sequence         = 0;
+        U64 tick_count       = 0; // Timer ticks since boot
+        U64 time_since_start = 0; // Nanoseconds since boot
+
+        /**
+         * @brief Take a consistent snapshot of the clock.
+         * @param tick_count_out       Timer ticks since boot.
+         * @param time_since_start_out Nanoseconds since boot.
+         */
+        void read(U64& tick_count_out, U64& time_since_start_out) const {
+            U32 seq_begin = 0;
+            U32 seq_end   = 0;
+            do {
+                seq_begin            = __atomic_load_n(&sequence, __ATOMIC_ACQUIRE);
+                tick_count_out       = __atomic_load_n(&tick_count, __ATOMIC_RELAXED);
+                time_since_start_out = __atomic_load_n(&time_since_start, __ATOMIC_RELAXED);
+                __atomic_thread_fence(__ATOMIC_ACQUIRE);
+                seq_end = __atomic_load_n(&sequence, __ATOMIC_RELAXED);
+            } while ((seq_begin & 1) != 0 || seq_begin != seq_end);
+        }
+    };
+
+    /**
+     * @brief Information about the app and the kernel that apps can read without a system call.
+     *
+     * The kernel maps the info page read-only into the address space of every app and passes its
+     * address in the start info of the main thread.
+     *
+     * The page is shared by all threads of an app, so it only holds app wide values. thread_handle
+     * is always the ID of the main thread, threads started with Threading::THREAD_CREATE must not
+     * use it as their own ID.
+     */
+    struct KernelInfo {
+        const KernelClock* clock         = nullptr; // The kernel clock
+        U64                page_size     = 0;       // Same as Memory::GET_PAGE_SIZE
+        ResourceID         app_handle    = 0;       // Same as App::GET_ID
+        ResourceID         thread_handle = 0;       // ID of the main thread of the app
+    };
+
+#define WAIT_EVENT_TYPES(X)                                                                        \
+    X(WaitEventType, NODE_READABLE, 0x1)                                                           \
+    X(WaitEventType, STDIN_KEY, 0x2)                                                               \
+    X(WaitEventType, APP_EXIT, 0x3)                                                                \
+    X(WaitEventType, MUTEX_UNLOCKED, 0x4)
+
+    /// @brief Describes the events a wait set can wait for, the resource of a wait set entry
+    ///         depends on the event type.
+    ///
+    /// NODE_READABLE: The node opened for reading has data, resource is the node handle.<br>
+    /// STDIN_KEY: A key is in the stdin buffer, the resource is ignored.<br>
+    /// APP_EXIT: The app has exited, resource is the app handle and the result is the exit
+    ///             code.<br>
+    /// MUTEX_UNLOCKED: The mutex has no owner, resource is the mutex handle.<br>
+    DECLARE_ENUM(WaitEventType, WAIT_EVENT_TYPES, 0x0) // NOLINT
+
+    /// @brief Wait without a timeout until at least one event is ready.
+    constexpr U64 WAIT_FOREVER = static_cast<U64>(-1);
+
+    /// @brief Maximum number of events a single wait returns.
+    constexpr U16 WAIT_EVENT_LIMIT = 64;
+
+    /// @brief A ready event that is reported by a wait set.
+    struct WaitEvent {
+        U64           user_data = 0; // As passed when the event was added to the wait set
+        ResourceID    resource  = 0;
+        WaitEventType type      = WaitEventType::NONE;
+        int           result    = 0; // Event specific result, e.g. the exit code of an app
+    };
+
+    /// @brief Number of buckets of a system call latency histogram, bucket i counts the system
+    ///         calls that took [2^i, 2^(i+1)) TSC cycles and the last bucket all slower ones.
+    constexpr U8 SYSTEM_CALL_LATENCY_BUCKETS = 32;
+
+    /// @brief Maximum number of records a single trace read returns.
+    constexpr U16 SYSTEM_CALL_TRACE_READ_LIMIT = 64;
+
+    /// @brief A system call made by a traced app.
+    struct SystemCallTraceRecord {
+        U64                sequence      = 0;  // Position of the record in the trace of its core
+        U64                start         = 0;  // TSC when the kernel started the system call
+        U64                cycles        = 0;  // TSC cycles spent in the kernel
+        SystemCallArgument args[6]       = {}; // NOLINT Is Kernel ABI
+        ResourceID         ID            = 0;
+        ResourceID         app_handle    = 0;
+        ResourceID         thread_handle = 0;
+        StatusCode         status        = 0;
+    };
+
+    /// @brief Latency statistics of a system call, only calls made by traced apps are counted.
+    struct SystemCallStats {
+        U64        count                                          = 0;
+        U64        total_cycles                                   = 0;
+        U64        max_cycles                                     = 0;
+        U64        latency_histogram[SYSTEM_CALL_LATENCY_BUCKETS] = {}; // NOLINT Is Kernel ABI
+        ResourceID ID                                             = 0;
+    };
+
+    /// @brief Resources used by an app, CPU time is measured in TSC cycles.
+    struct AppResourceUsage {
+        char       name[STRING_SIZE_LIMIT] = {}; // NOLINT Is ABI -> Must use C-style array
+        U64        user_cycles             = 0;
+        U64        kernel_cycles           = 0;
+        U64        heap_pages              = 0; // Pages allocated with the memory system calls
+        U64        peak_heap_pages         = 0;
+        U64        bytes_read              = 0;
+        U64        bytes_written           = 0;
+        U64        system_call_count       = 0;
+        ResourceID app_handle              = 0;
+        U32        thread_count            = 0;
+    };
 } // namespace Ember
 
 #endif // EMBER_APP_H
@@ -100,6 +100,8 @@ namespace Ember {
      *  <li>NODE_IS_FILE: A node is a file but should be a directory.</li>
      *  <li>NODE_IN_USE: A node is in use by another application.</li>
      *  <li>NODE_CLOSED: The node has already been closed.</li>
+     *  <li>FUTEX_VALUE_CHANGED: The futex did not have the expected value.</li>
+     *  <li>FUTEX_TIMED_OUT: The futex was not woken before the timeout.</li>
      * </ul>
      */
 #define STATUSES(X)                                                                                \
@@ -116,7 +118,9 @@ namespace Ember {
     X(Status, NODE_IS_DIRECTORY, -102)                                                             \
     X(Status, NODE_IS_FILE, -103)                                                                  \
     X(Status, NODE_IN_USE, -104)                                                                   \
-    X(Status, NODE_CLOSED, -105)
+    X(Status, NODE_CLOSED, -105)                                                                   \
+    X(Status, FUTEX_VALUE_CHANGED, -200)                                                           \
+    X(Status, FUTEX_TIMED_OUT, -201)
 
     DECLARE_TYPED_ENUM(Status, StatusCode, STATUSES, 0x0) // NOLINT
 } // namespace Ember
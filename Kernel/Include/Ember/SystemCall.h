@@ -0,0 +1,66 @@
+/*
+ *  Copyright 2025 Ewogijk
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef EMBER_SYSTEMCALL_H
+#define EMBER_SYSTEMCALL_H
+
+#include <Ember/Ember.h>
+
+namespace Ember {
+
+    /**
+     * <p>
+     *  Apps use this when Forge has no wrapper for a system call yet. The arguments are passed as
+     *  described by the system call ABI: rax=ID, rdi=arg1, rsi=arg2, rdx=arg3, r8=arg4, r9=arg5
+     *  and r10=arg6.
+     * </p>
+     * <p>
+     *  The kernel handles the system call with C++ code, so the argument registers are not
+     *  preserved and "syscall" itself overwrites rcx and r11. All of them are declared as
+     *  clobbered, only rbx, rbp, r12-r15 and rsp survive the system call.
+     * </p>
+     *
+     * @brief Make a system call directly with the "syscall" instruction.
+     * @param ID   System call ID.
+     * @param arg1 First system call argument.
+     * @param arg2 Second system call argument.
+     * @param arg3 Third system call argument.
+     * @param arg4 Fourth system call argument.
+     * @param arg5 Fifth system call argument.
+     * @param arg6 Sixth system call argument.
+     * @return The system call status code.
+     */
+    inline auto system_call(const ResourceID   ID,
+                            SystemCallArgument arg1 = 0,
+                            SystemCallArgument arg2 = 0,
+                            SystemCallArgument arg3 = 0,
+                            SystemCallArgument arg4 = 0,
+                            SystemCallArgument arg5 = 0,
+                            SystemCallArgument arg6 = 0) -> StatusCode {
+        // There are no constraints for r8-r10 -> Bind the arguments to them explicitly
+        register SystemCallArgument r8 asm("r8")   = arg4;
+        register SystemCallArgument r9 asm("r9")   = arg5;
+        register SystemCallArgument r10 asm("r10") = arg6;
+        U64                         ret            = ID;
+        asm volatile("syscall"
+                     : "+a"(ret), "+D"(arg1), "+S"(arg2), "+d"(arg3), "+r"(r8), "+r"(r9), "+r"(r10)
+                     :
+                     : "rcx", "r11", "memory");
+        return static_cast<StatusCode>(ret);
+    }
+} // namespace Ember
+
+#endif // EMBER_SYSTEMCALL_H
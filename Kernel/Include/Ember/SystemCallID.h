@@ -37,7 +37,13 @@ namespace Ember {
     X(Threading, MUTEX_UNLOCK, 202)                                                                \
     X(Threading, MUTEX_FREE, 203)                                                                  \
     X(Threading, THREAD_GET_ID, 204)                                                               \
-    X(Threading, THREAD_CONTROL_BLOCK_SET, 205)
+    X(Threading, THREAD_CONTROL_BLOCK_SET, 205)                                                    \
+    X(Threading, FUTEX_WAIT, 206)                                                                  \
+    X(Threading, FUTEX_WAKE, 207)                                                                  \
+    X(Threading, THREAD_CREATE, 208)                                                               \
+    X(Threading, THREAD_JOIN, 209)                                                                 \
+    X(Threading, THREAD_EXIT, 210)                                                                 \
+    X(Threading, THREAD_YIELD, 211)
 
     DECLARE_TYPED_ENUM(Threading, ResourceID, THREADING_SYSCALLS, 0x0) // NOLINT
 
@@ -54,7 +60,9 @@ namespace Ember {
     X(VFS, SEEK, 308)                                                                              \
     X(VFS, DIRECTORY_STREAM_OPEN, 309)                                                             \
     X(VFS, DIRECTORY_STREAM_NEXT, 310)                                                             \
-    X(VFS, DIRECTORY_STREAM_CLOSE, 311)
+    X(VFS, DIRECTORY_STREAM_CLOSE, 311)                                                            \
+    X(VFS, IO_RING_SETUP, 312)                                                                     \
+    X(VFS, IO_RING_ENTER, 313)
 
     DECLARE_TYPED_ENUM(VFS, ResourceID, VFS_SYSCALLS, 0x0) // NOLINT
 
@@ -68,7 +76,18 @@ namespace Ember {
     X(App, EXIT, 405)                                                                              \
     X(App, JOIN, 406)                                                                              \
     X(App, CURRENT_DIRECTORY, 407)                                                                 \
-    X(App, CHANGE_DIRECTORY, 408)
+    X(App, CHANGE_DIRECTORY, 408)                                                                  \
+    X(App, READ_STDIN_KEYS, 409)                                                                   \
+    X(App, WAIT_SET_CREATE, 410)                                                                   \
+    X(App, WAIT_SET_ADD, 411)                                                                      \
+    X(App, WAIT_SET_REMOVE, 412)                                                                   \
+    X(App, WAIT_SET_WAIT, 413)                                                                     \
+    X(App, WAIT_SET_FREE, 414)                                                                     \
+    X(App, TRACE_SYSTEM_CALLS, 415)                                                                \
+    X(App, READ_SYSTEM_CALL_TRACE, 416)                                                            \
+    X(App, READ_SYSTEM_CALL_STATS, 417)                                                            \
+    X(App, CLONE, 418)                                                                             \
+    X(App, READ_RESOURCE_USAGE, 419)
 
     DECLARE_TYPED_ENUM(App, ResourceID, APP_SYSCALLS, 0x0) // NOLINT
 } // namespace Ember
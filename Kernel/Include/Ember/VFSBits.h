@@ -89,6 +89,79 @@ namespace Ember {
 
         [[nodiscard]] auto is_file() const -> bool;
     };
+
+    /**
+     * @brief The operations that can be submitted to an IO ring. Each operation takes the same
+     * arguments and returns the same status codes as the VFS system call of the same name.
+     * <ul>
+     *  <li>OPEN: arg1 = node path, arg2 = IO mode.</li>
+     *  <li>CLOSE: arg1 = node ID.</li>
+     *  <li>READ: arg1 = node ID, arg2 = buffer, arg3 = buffer size.</li>
+     *  <li>WRITE: arg1 = node ID, arg2 = buffer, arg3 = buffer size.</li>
+     *  <li>SEEK: arg1 = node ID, arg2 = seek mode, arg3 = offset.</li>
+     *  <li>GET_NODE_INFO: arg1 = node path, arg2 = node info buffer.</li>
+     *  <li>DIRECTORY_STREAM_NEXT: arg1 = directory stream ID, arg2 = node info buffer.</li>
+     * </ul>
+     */
+#define IO_RING_OPS(X)                                                                             \
+    X(IORingOp, OPEN, 0x1)                                                                         \
+    X(IORingOp, CLOSE, 0x2)                                                                        \
+    X(IORingOp, READ, 0x3)                                                                         \
+    X(IORingOp, WRITE, 0x4)                                                                        \
+    X(IORingOp, SEEK, 0x5)                                                                         \
+    X(IORingOp, GET_NODE_INFO, 0x6)                                                                \
+    X(IORingOp, DIRECTORY_STREAM_NEXT, 0x7)
+
+    DECLARE_TYPED_ENUM(IORingOp, U8, IO_RING_OPS, 0x0) // NOLINT
+
+    /**
+     * @brief Maximum number of entries in the submission and completion queue of an IO ring.
+     */
+    constexpr U32 IO_RING_ENTRY_LIMIT = 4096;
+
+    /**
+     * @brief A VFS operation requested by the app.
+     */
+    struct IORingSubmission {
+        U64 user_data = 0; // Passed unchanged to the completion of the operation
+        U64 arg1      = 0;
+        U64 arg2      = 0;
+        U64 arg3      = 0;
+        U8  op        = IORingOp::NONE;
+    };
+
+    /**
+     * @brief The outcome of a submitted VFS operation.
+     */
+    struct IORingCompletion {
+        U64        user_data = 0;
+        StatusCode status    = Status::OKAY;
+    };
+
+    /**
+     * @brief A submission and completion queue shared between an app and the kernel.
+     *
+     * <p>
+     *  The app allocates the ring and both queues in its own memory and registers the ring with
+     * the kernel. It then appends operations to the submission queue and lets the kernel process a
+     * whole batch of them with a single system call, the kernel appends a completion for every
+     * processed operation to the completion queue.
+     * </p>
+     * <p>
+     *  The queue indices are free running and wrap around at 2^32, entry i of a queue is stored at
+     * index (i & (entry_count - 1)). A queue is empty when head == tail and full when
+     * tail - head == entry_count.
+     * </p>
+     */
+    struct IORing {
+        IORingSubmission* submissions = nullptr;
+        IORingCompletion* completions = nullptr;
+        U32               entry_count = 0; // Power of two, at most IO_RING_ENTRY_LIMIT
+        U32               sq_head     = 0; // Next submission the kernel processes, kernel owned
+        U32               sq_tail     = 0; // Next free submission slot, app owned
+        U32               cq_head     = 0; // Next completion the app consumes, app owned
+        U32               cq_tail     = 0; // Next free completion slot, kernel owned
+    };
 } // namespace Ember
 
 #endif // EMBER_VFSBITS_H
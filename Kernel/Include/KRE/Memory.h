@@ -352,7 +352,8 @@ namespace Rune {
     X(MemoryRegionType, KERNEL_HEAP, 0x7)                                                          \
     X(MemoryRegionType, KERNEL_CODE, 0x8)                                                          \
     X(MemoryRegionType, ACPI, 0x9)                                                                 \
-    X(MemoryRegionType, BOOTLOADER_RECLAIMABLE, 0xA)
+    X(MemoryRegionType, BOOTLOADER_RECLAIMABLE, 0xA)                                               \
+    X(MemoryRegionType, KERNEL_STACKS, 0xB)
 
     DECLARE_ENUM(MemoryRegionType, MEMORY_REGION_TYPES, 0x0) // NOLINT
 
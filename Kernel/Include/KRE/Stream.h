@@ -24,6 +24,10 @@
 #include <KRE/Collections/Array.h>
 
 namespace Rune {
+    namespace CPU {
+        class WaitQueue;
+    }
+
     //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
     //                                      Stream API
     //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -48,6 +52,29 @@ namespace Rune {
          */
         virtual auto read() -> int = 0;
 
+        /**
+         * @brief Block the calling thread until the stream has data to read.
+         *
+         * Streams that cannot block return immediately, the caller has to poll them instead.
+         *
+         * @return True: The stream had data to read when the thread was woken, False: The stream
+         * does not support blocking reads.
+         */
+        virtual auto wait_for_input() -> bool { return false; }
+
+        /**
+         * @brief
+         * @return True: The stream has data to read, False: A read would return no data.
+         */
+        virtual auto has_input() -> bool { return true; }
+
+        /**
+         * @brief Get the wait queue that is woken when the stream receives new data, e.g. to wait
+         * for the stream together with other events.
+         * @return The wait queue or a nullptr if the stream cannot block.
+         */
+        virtual auto get_input_wait_queue() -> CPU::WaitQueue* { return nullptr; }
+
         /**
          * @brief Read at most size bytes at the given offset into the buffer.
          * @param buffer
@@ -91,6 +118,24 @@ namespace Rune {
          */
         virtual auto write(U8 value) -> bool = 0;
 
+        /**
+         * @brief Write size bytes from the buffer to the stream.
+         *
+         * Streams that can write a batch of bytes faster than single bytes should override this.
+         *
+         * @param buffer
+         * @param size
+         * @return The number of bytes written.
+         */
+        virtual auto write_buffer(const char* buffer, size_t size) -> size_t {
+            size_t bytes_written = 0;
+            while (bytes_written < size) {
+                if (!write(static_cast<U8>(buffer[bytes_written]))) break;
+                bytes_written++;
+            }
+            return bytes_written;
+        }
+
         /**
          * @brief Write size number of bytes from the offset in the buffer to the stream.
          * @param buffer
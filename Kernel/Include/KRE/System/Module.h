@@ -22,7 +22,8 @@
 
 #include <KRE/Memory.h>
 
-#include <KRE/Collections/HashMap.h>
+#include <KRE/Collections/Array.h>
+#include <KRE/Collections/LinkedList.h>
 
 #include <KRE/System/EventHook.h>
 #include <KRE/System/FrameBuffer.h>
@@ -56,20 +57,54 @@ namespace Rune {
         [[nodiscard]] auto to_string() const -> String;
     };
 
+/**
+ * Expand the event hook X-macro of a module with this macro to check at compile time that the IDs
+ * of all its event hooks fit into the event hook table.
+ */
+#define ASSERT_EVENT_HOOK_FITS(ClassName, Name, Value)                                             \
+    static_assert((Value) < Rune::Module::MAX_EVENT_HOOK_COUNT,                                    \
+                  #ClassName "::" #Name " exceeds Module::MAX_EVENT_HOOK_COUNT");
+
     /**
      * A kernel module is a major component of the kernel e.g. the memory management.
      */
     class Module {
+      public:
+        /// @brief Event hook IDs are the values of a module specific enum, zero is the NONE value.
+        static constexpr U8 MAX_EVENT_HOOK_COUNT = 8;
+        /// @brief Maximum number of event handlers that can be installed on a single event hook.
+        static constexpr U8 MAX_EVENT_HANDLER_COUNT = 8;
+
+      private:
+        /**
+         * @brief The installed event handlers of an event hook.
+         */
+        struct EventHookSlot {
+            // Null: The module never added the event hook, so no handlers can be installed on it
+            const char*                                            name = nullptr;
+            Array<EventHandlerTableEntry, MAX_EVENT_HANDLER_COUNT> handlers;
+            U8                                                     handler_count = 0;
+        };
+
+        // Indexed by the event hook ID, so firing an event is a plain array access
+        Array<EventHookSlot, MAX_EVENT_HOOK_COUNT> _event_hook_table;
+        HandleCounter<U16>                         _event_hook_handle_counter{};
+
       protected:
-        HashMap<String, LinkedList<EventHandlerTableEntry>> _event_hook_table;            // NOLINT
-        HandleCounter<U16>                                  _event_hook_handle_counter{}; // NOLINT
+        /**
+         * @brief Add an event hook to the event hook table, so event handlers can be installed on
+         * it.
+         * @param evt_hook ID of the event hook.
+         * @param name     Name of the event hook, it is only used for diagnostics.
+         */
+        void add_event_hook(U8 evt_hook, const char* name);
 
         /**
-         * @brief Fire an event for the given evtHook with the evtContext.
-         * @param evt_hook
+         * @brief Call all event handlers installed on the event hook with the event context.
+         * @param evt_hook    ID of the event hook.
          * @param evt_context
          */
-        void fire(const String& evt_hook, void* evt_context);
+        void fire(U8 evt_hook, void* evt_context);
 
       public:
         explicit Module();
@@ -124,26 +159,28 @@ namespace Rune {
         /**
          * @brief Try to install the given event handler on the requested event hook.
          *
-         * If the event handler got successfully installed the assigned ID (< 0) will be returned if
-         * the installation failed -1 is returned.
+         * If the event handler got successfully installed the assigned ID (> 0) will be returned if
+         * the installation failed 0 is returned.
          *
-         * @param event_hook
+         * @param event_hook       ID of the event hook.
+         * @param evt_handler_name
          * @param handler
-         * @return ID > 0: The event handler will now receive events, ID == -1: The event handler
-         * was not installed because the requested event hook is not supported.
+         * @return ID > 0: The event handler will now receive events, ID == 0: The event handler
+         * was not installed because the requested event hook is not supported or has no space for
+         * more event handlers.
          */
-        auto install_event_handler(const String&       event_hook,
+        auto install_event_handler(U8                  event_hook,
                                    const String&       evt_handler_name,
                                    const EventHandler& handler) -> U16;
 
         /**
          * @brief Try to uninstall the event handler with the given evtHandlerID from an event hook.
-         * @param event_hook
+         * @param event_hook     ID of the event hook.
          * @param evt_handler_id
          * @return True: The event handler will no longer receive events, False: The event handler
          * was not installed on this event hook or the event hook is not supported.
          */
-        auto uninstall_event_handler(const String& event_hook, U16 evt_handler_id) -> bool;
+        auto uninstall_event_handler(U8 event_hook, U16 evt_handler_id) -> bool;
     };
 } // namespace Rune
 
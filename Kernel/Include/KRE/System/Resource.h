@@ -72,7 +72,7 @@ namespace Rune {
     };
 
     // ========================================================================================== //
-    // HandleFactory
+    // HandleCounter
     // ========================================================================================== //
 
     /// @brief The handle counter provides unique handles for newly created resources.
@@ -110,30 +110,223 @@ namespace Rune {
     /// @brief Type of handle.
     using Handle = U32;
 
-    /// @brief The handle factory is responsible to provide unique handles and
-    class HandleFactory {
-        Handle             m_counter{0};
-        LinkedList<Handle> m_free_list;
+    // ========================================================================================== //
+    // HandleTable
+    // ========================================================================================== //
+
+    /// @brief A slot array that assigns recyclable handles to resources and finds a resource by its
+    ///         handle without hashing.
+    ///
+    /// A handle is made of the index of its slot in the low bits and the generation of the slot in
+    /// the high bits. The generation of a slot is incremented whenever the slot is freed, thus a
+    /// stale handle of a removed resource does not find the resource that reuses the slot until
+    /// the generation wraps around. Free slots are reused in FIFO order to make this unlikely.
+    ///
+    /// The generation is never zero, so no handle is HANDLE_NONE.
+    ///
+    /// Of the handle bits 5/8 are the index and 3/8 the generation. This caps the number of
+    /// resources in a table: U16 handles have 10 index bits and 6 generation bits, a table holds at
+    /// most 1024 resources at once and a slot is reused 63 times before its generation wraps. A
+    /// table with all slots in use hands out no more handles.
+    ///
+    /// @tparam T      Type of the stored resource.
+    /// @tparam Handle Type of the handle, at most 32 bits.
+    template <typename T, Integer Handle>
+    class HandleTable {
+        static_assert(sizeof(Handle) <= sizeof(U32), "Handles are limited to 32 bits");
+
+        // U16 handles: 1024 slots with 63 generations each, U32 handles: 1M slots with 4095
+        static constexpr U8  INDEX_BITS      = sizeof(Handle) * 8 * 5 / 8;
+        static constexpr U32 INDEX_MASK      = (1U << INDEX_BITS) - 1;
+        static constexpr U32 GENERATION_MASK = static_cast<Handle>(-1) >> INDEX_BITS;
+        static constexpr U32 SLOT_LIMIT      = INDEX_MASK + 1;
+        static constexpr U32 MIN_CAPACITY    = 16;
+        static constexpr U32 NO_SLOT         = static_cast<U32>(-1);
+
+        struct Slot {
+            SharedPointer<T> value;
+            U32              generation = 1;
+            U32              next_free  = NO_SLOT;
+            bool             is_used    = false;
+        };
+
+        Slot*  _slots;
+        U32    _capacity;
+        U32    _slot_count; // Number of slots that were used at least once
+        U32    _free_head;
+        U32    _free_tail;
+        size_t _size;
+
+        [[nodiscard]] auto make_handle(U32 index) const -> Handle {
+            return static_cast<Handle>((_slots[index].generation << INDEX_BITS) | index);
+        }
+
+        [[nodiscard]] auto find_slot(Handle handle) const -> Slot* {
+            const U32 index = handle & INDEX_MASK;
+            if (index >= _slot_count) return nullptr;
+            Slot* slot = &_slots[index];
+            return slot->is_used && slot->generation == (handle >> INDEX_BITS) ? slot : nullptr;
+        }
+
+        auto grow() -> bool {
+            const U32 new_capacity = _capacity == 0 ? MIN_CAPACITY
+                                     : _capacity * 2 < SLOT_LIMIT ? _capacity * 2
+                                                                  : SLOT_LIMIT;
+            if (new_capacity <= _capacity) return false;
+            auto* new_slots = new Slot[new_capacity];
+            if (new_slots == nullptr) return false;
+            for (U32 i = 0; i < _slot_count; i++) new_slots[i] = move(_slots[i]);
+            delete[] _slots;
+            _slots    = new_slots;
+            _capacity = new_capacity;
+            return true;
+        }
 
       public:
-        explicit HandleFactory() = default;
+        /// @brief Iterates over all slots that hold a resource.
+        class Iterator {
+            const HandleTable* _table;
+            U32                _index;
 
-        /// @brief
-        /// @return
-        auto borrow() -> Handle {
-            if (!m_free_list.empty()) {
-                return m_free_list.remove_back().value();
+            void skip_empty_slots() {
+                while (_index < _table->_slot_count && !_table->_slots[_index].value) _index++;
+            }
+
+          public:
+            Iterator(const HandleTable* table, U32 index) : _table(table), _index(index) {
+                skip_empty_slots();
             }
 
-            return ++m_counter;
+            auto operator*() const -> const SharedPointer<T>& {
+                return _table->_slots[_index].value;
+            }
+
+            auto operator++() -> Iterator& {
+                _index++;
+                skip_empty_slots();
+                return *this;
+            }
+
+            auto operator==(const Iterator& other) const -> bool { return _index == other._index; }
+
+            auto operator!=(const Iterator& other) const -> bool { return _index != other._index; }
+        };
+
+        HandleTable()
+            : _slots(nullptr),
+              _capacity(0),
+              _slot_count(0),
+              _free_head(NO_SLOT),
+              _free_tail(NO_SLOT),
+              _size(0) {}
+
+        ~HandleTable() { delete[] _slots; }
+
+        HandleTable(const HandleTable&)                    = delete;
+        HandleTable(HandleTable&&)                         = delete;
+        auto operator=(const HandleTable&) -> HandleTable& = delete;
+        auto operator=(HandleTable&&) -> HandleTable&      = delete;
+
+        /**
+         * @brief
+         * @return Number of acquired handles.
+         */
+        [[nodiscard]] auto size() const -> size_t { return _size; }
+
+        /**
+         * @brief Check if the table has free handles.
+         * @return True: A handle can be acquired, False: All slots are in use.
+         */
+        [[nodiscard]] auto has_more() const -> bool {
+            return _free_head != NO_SLOT || _slot_count < SLOT_LIMIT;
         }
 
-        /// @brief
-        /// @param handle
-        auto give_back(Handle handle) -> void {
-            SILENCE_UNUSED(handle)
-            m_free_list.add_back(handle);
+        /**
+         * @brief Reserve a slot and get its handle, the slot has no resource until put() is called.
+         * @return A handle or HANDLE_NONE if all slots are in use.
+         */
+        auto acquire() -> Handle {
+            U32 index = _free_head;
+            if (index != NO_SLOT) {
+                _free_head = _slots[index].next_free;
+                if (_free_head == NO_SLOT) _free_tail = NO_SLOT;
+            } else {
+                if (_slot_count == _capacity && !grow()) return Resource<Handle>::HANDLE_NONE;
+                index = _slot_count++;
+            }
+            _slots[index].is_used   = true;
+            _slots[index].next_free = NO_SLOT;
+            _size++;
+            return make_handle(index);
+        }
+
+        /**
+         * @brief Store the resource in the slot of an acquired handle.
+         * @param handle
+         * @param value
+         * @return True: The resource is stored, False: The handle was not acquired or is stale.
+         */
+        auto put(Handle handle, const SharedPointer<T>& value) -> bool {
+            Slot* slot = find_slot(handle);
+            if (slot == nullptr) return false;
+            slot->value = value;
+            return true;
+        }
+
+        /**
+         * @brief Free the slot of the handle, the handle becomes stale and the slot can be reused.
+         * @param handle
+         * @return True: The slot is freed, False: The handle was not acquired or is stale.
+         */
+        auto remove(Handle handle) -> bool {
+            Slot* slot = find_slot(handle);
+            if (slot == nullptr) return false;
+
+            const U32 index  = handle & INDEX_MASK;
+            slot->value      = SharedPointer<T>();
+            slot->is_used    = false;
+            slot->generation = (slot->generation + 1) & GENERATION_MASK;
+            if (slot->generation == 0) slot->generation = 1;
+            if (_free_tail == NO_SLOT)
+                _free_head = index;
+            else
+                _slots[_free_tail].next_free = index;
+            _free_tail = index;
+            _size--;
+            return true;
+        }
+
+        /**
+         * @brief Free all slots, all handles become stale.
+         */
+        void clear() {
+            for (U32 i = 0; i < _slot_count; i++)
+                if (_slots[i].is_used) remove(make_handle(i));
         }
+
+        /**
+         * @brief Search for the resource with the handle.
+         * @param handle
+         * @return The resource or a null pointer if the handle is stale or the slot is empty.
+         */
+        [[nodiscard]] auto find(Handle handle) const -> SharedPointer<T> {
+            Slot* slot = find_slot(handle);
+            return slot == nullptr ? SharedPointer<T>() : slot->value;
+        }
+
+        /**
+         * @brief
+         * @return A copy of all resources in the table.
+         */
+        [[nodiscard]] auto values() const -> LinkedList<SharedPointer<T>> {
+            LinkedList<SharedPointer<T>> copy;
+            for (const auto& value : *this) copy.add_back(value);
+            return copy;
+        }
+
+        [[nodiscard]] auto begin() const -> Iterator { return Iterator(this, 0); }
+
+        [[nodiscard]] auto end() const -> Iterator { return Iterator(this, _slot_count); }
     };
 
     // ====================================================================================== //
@@ -286,12 +479,15 @@ namespace Rune {
     // ========================================================================================== //
 
     /// @brief A cache of userspace accessible resources e.g., files or mutexes.
+    ///
+    /// The resources get U16 handles from a HandleTable, at most 1024 resources of a cache exist at
+    /// once.
+    ///
     /// @tparam ResourceType Type of the stored resource.
     /// @tparam ColumnCount  Number of columns used when printing the table.
     template <typename ResourceType, size_t ColumnCount>
     class ResourceCache {
-        HashMap<Handle, SharedPointer<ResourceType>>                             m_resources{};
-        HandleFactory                                                            m_handle_factory;
+        HandleTable<ResourceType, U16>                                           m_resources;
         Array<String, ColumnCount>                                               m_column_headers;
         Function<Array<String, ColumnCount>(const SharedPointer<ResourceType>&)> m_row_converter;
 
@@ -305,9 +501,7 @@ namespace Rune {
         /// @brief
         /// @return Return a raw-pointer copy of all resources in the table.
         [[nodiscard]] auto get_resources() const -> LinkedList<SharedPointer<ResourceType>> {
-            LinkedList<SharedPointer<ResourceType>> copy;
-            for (const auto& resource : m_resources) copy.add_back(*resource.value);
-            return copy;
+            return m_resources.values();
         }
 
         /// @brief Allocate a new resource on the heap and assign it a unique handle.
@@ -317,9 +511,10 @@ namespace Rune {
         /// @return The created resource, or null if no handles are available.
         template <typename... Args>
         auto allocate(const String& name, Args&&... args) -> SharedPointer<ResourceType> {
-            auto resource =
-                make_shared<ResourceType>(m_handle_factory.borrow(), name, forward<Args>(args)...);
-            m_resources.put(resource->get_handle(), resource);
+            const U16 handle = m_resources.acquire();
+            if (handle == Resource<U16>::HANDLE_NONE) return SharedPointer<ResourceType>();
+            auto resource = make_shared<ResourceType>(handle, name, forward<Args>(args)...);
+            m_resources.put(handle, resource);
             return resource;
         }
 
@@ -331,20 +526,15 @@ namespace Rune {
          * @param handle Handle of the resource to delete.
          * @return True if the resource was deleted, false if no such resource exists.
          */
-        auto free(Handle handle) -> bool {
-            bool freed = m_resources.remove(handle);
-            if (freed) m_handle_factory.give_back(handle);
-            return freed;
-        }
+        auto free(U16 handle) -> bool { return m_resources.remove(handle); }
 
         /**
          * @brief Search for a resource instance by handle.
          * @param handle Handle of the requested resource.
          * @return The resource, or null if no resource with the handle exists.
          */
-        [[nodiscard]] auto find(Handle handle) const -> SharedPointer<ResourceType> {
-            auto it = m_resources.find(handle);
-            return it == m_resources.end() ? SharedPointer<ResourceType>() : *it->value;
+        [[nodiscard]] auto find(U16 handle) const -> SharedPointer<ResourceType> {
+            return m_resources.find(handle);
         }
 
         /**
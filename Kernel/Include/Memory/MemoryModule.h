@@ -30,7 +30,8 @@ namespace Rune::Memory {
      * physical and virtual memory maps.
      */
     class MemoryModule : public Module {
-        static constexpr size_t HEAP_SIZE = 128 * MemoryUnit::MiB;
+        static constexpr size_t HEAP_SIZE          = 128 * MemoryUnit::MiB;
+        static constexpr size_t KERNEL_STACKS_SIZE = 256 * MemoryUnit::MiB;
 
         MemoryMap _p_map;
         MemoryMap _v_map;
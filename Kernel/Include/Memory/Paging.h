@@ -88,6 +88,13 @@ namespace Rune::Memory {
          */
         [[nodiscard]] auto is_user_mode_access_allowed() const -> bool;
 
+        /**
+         *
+         * @return True if the page frame is shared with another virtual address space and must be
+         * copied before it is written else false.
+         */
+        [[nodiscard]] auto is_copy_on_write() const -> bool;
+
         /**
          * @brief
          * @return True: The PTE points to a page frame, False: The PTE points to a page table.
@@ -278,6 +285,12 @@ namespace Rune::Memory {
 
     /**
      * A page flag represents a property of a page table entry.
+     *
+     * <p>
+     *  COPY_ON_WRITE is ignored by the MMU, it marks a read-only page whose page frame is shared
+     * with another virtual address space. The page becomes writable again once it got its own copy
+     * of the page frame.
+     * </p>
      */
 #define PAGE_FLAGS(X)                                                                              \
     X(PageFlag, PRESENT, 0x01)                                                                     \
@@ -286,7 +299,8 @@ namespace Rune::Memory {
     X(PageFlag, WRITE_THROUGH, 0x08)                                                               \
     X(PageFlag, CACHE_DISABLE, 0x10)                                                               \
     X(PageFlag, ACCESSED, 0x20)                                                                    \
-    X(PageFlag, DIRTY, 0x40)
+    X(PageFlag, DIRTY, 0x40)                                                                       \
+    X(PageFlag, COPY_ON_WRITE, 0x200)
 
     DECLARE_TYPED_ENUM(PageFlag, U16, PAGE_FLAGS, 0) // NOLINT
 
@@ -395,6 +409,26 @@ namespace Rune::Memory {
     auto modify_page_flags(const PageTable& base_pt, VirtualAddr v_addr, U16 flags, bool set)
         -> PageTableAccess;
 
+    /**
+     * Map an already mapped page to another page frame, intermediate page tables are not touched.
+     *
+     * <p>
+     *  The caller maintains both page frames, the old page frame is neither freed nor is the new
+     * page frame allocated.
+     * </p>
+     *
+     * @param base_pt    Base page table.
+     * @param v_addr     Virtual address.
+     * @param page_frame Physical address of the new page frame.
+     * @param flags      Page table entry flags.
+     *
+     * @return Result of the page table access.
+     */
+    auto remap_page(const PageTable& base_pt,
+                    VirtualAddr      v_addr,
+                    PhysicalAddr     page_frame,
+                    U16              flags) -> PageTableAccess;
+
     /**
      * Try to find the page for the given virtual address.
      *
@@ -23,6 +23,8 @@
 #include <KRE/Logging.h>
 #include <KRE/Memory.h>
 
+#include <KRE/Collections/HashMap.h>
+
 namespace Rune::Memory {
     using PageFrameIndex = U32;
 
@@ -41,6 +43,9 @@ namespace Rune::Memory {
      * memory regions are not accidentally freed.
      */
     class PhysicalMemoryManager {
+        // Page frames with more than one reference -> Number of additional references
+        HashMap<PhysicalAddr, U32> _shared_frames;
+
         auto detect_memory_range() -> bool;
 
       protected:
@@ -186,12 +191,36 @@ namespace Rune::Memory {
         /**
          * Try to free a single page frame with the given start address.<br>
          *
+         * If the page frame is shared only one reference to it is dropped and the page frame stays
+         * allocated until the last reference is freed.
+         *
          * @param p_addr Physical address of the page frame to be freed.
          *
          * @return True if the free succeeded, false if not enough physical memory is available.
          */
         auto free(PhysicalAddr p_addr) -> bool;
 
+        /**
+         * Add a reference to an allocated page frame, e.g. because it is mapped copy-on-write into
+         * another virtual address space. Every reference must be freed with a single page frame
+         * free.
+         *
+         * @param p_addr Physical address of an allocated page frame.
+         *
+         * @return True if the reference was added, false if the page frame is not managed by the
+         * pmm.
+         */
+        auto share(PhysicalAddr p_addr) -> bool;
+
+        /**
+         *
+         * @param p_addr Physical address of a page frame.
+         *
+         * @return Number of references to the page frame, a page frame that is not shared has a
+         * single reference.
+         */
+        [[nodiscard]] auto get_reference_count(PhysicalAddr p_addr) const -> U32;
+
         /**
          * Try to free a the requested number of consecutive page frames with the given start
          * address.
@@ -28,7 +28,8 @@ namespace Rune::Memory {
     X(VMMStartFailure, HHDM_MAPPING_FAIL, 0x2)                                                     \
     X(VMMStartFailure, KERNEL_CODE_MAPPING_FAIL, 0x3)                                              \
     X(VMMStartFailure, PMM_MAPPING_FAIL, 0x4)                                                      \
-    X(VMMStartFailure, KERNEL_HEAP_MAPPING_FAIL, 0x5)
+    X(VMMStartFailure, KERNEL_HEAP_MAPPING_FAIL, 0x5)                                              \
+    X(VMMStartFailure, KERNEL_STACKS_MAPPING_FAIL, 0x6)
 
     DECLARE_ENUM(VMMStartFailure, VMMStartFailures, 0x0) // NOLINT
 
@@ -68,6 +69,9 @@ namespace Rune::Memory {
 
         auto free_virtual_address_space_rec(const PageTableEntry& pte) -> bool;
 
+        // Copy the page tables of src to dst and share all page frames of src copy-on-write
+        auto clone_virtual_address_space_rec(PageTable src, PageTable dst) -> bool;
+
       public:
         explicit VirtualMemoryManager(PhysicalMemoryManager* pmm);
 
@@ -96,17 +100,20 @@ namespace Rune::Memory {
          * `PMap` is used to get the locations of all regions in the physical memory.
          * </p>
          *
-         * @param pMap           Physical memory map used to create page table entries.
-         * @param vMap           Virtual memory map
-         * @param kSpaceLayout   Kernel space layout.
-         * @param kernelHeapSize Requested kernel size.
+         * @param pMap             Physical memory map used to create page table entries.
+         * @param vMap             Virtual memory map
+         * @param kSpaceLayout     Kernel space layout.
+         * @param kernelHeapSize   Requested kernel size.
+         * @param kernelStacksSize Requested size of the kernel stack region, it must share the L4
+         * page table entry of the kernel heap, so it is present in every address space.
          *
          * @return True if the initial VAS got loaded else false.
          */
         [[nodiscard]] auto start(MemoryMap*        p_map,
                                  MemoryMap*        v_map,
                                  KernelSpaceLayout k_space_layout,
-                                 MemorySize        heap_size) -> VMMStartFailure;
+                                 MemorySize        heap_size,
+                                 MemorySize        kernel_stacks_size) -> VMMStartFailure;
 
         /**
          *
@@ -136,6 +143,38 @@ namespace Rune::Memory {
          */
         auto free_virtual_address_space(PhysicalAddr base_pt_addr) -> bool;
 
+        /**
+         * Allocate a new virtual address space with a copy-on-write clone of the user space of the
+         * virtual address space determined by the base page table at `src_base_pt_addr`.
+         *
+         * <p>
+         *  Only the page tables are copied, the page frames are shared by both virtual address
+         * spaces. Writable pages are made read-only and marked as copy-on-write in both virtual
+         * address spaces, the first write to such a page raises a page fault that must be resolved
+         * with `resolve_copy_on_write`.
+         * </p>
+         *
+         * @param src_base_pt_addr Physical address of the base page table that will be cloned.
+         * @param base_pt_addr     On success the physical address of the base page table of the
+         * clone will be assigned to this variable else the value is undefined.
+         *
+         * @return True if the virtual address space got cloned else false.
+         */
+        auto clone_virtual_address_space(PhysicalAddr src_base_pt_addr, PhysicalAddr& base_pt_addr)
+            -> bool;
+
+        /**
+         * Give the copy-on-write page of `v_addr` its own page frame and make it writable again. If
+         * no other virtual address space references the page frame anymore, it is not copied.
+         *
+         * @param base_pt A base page table.
+         * @param v_addr  Virtual address in a copy-on-write page.
+         *
+         * @return True if the page is writable, false if it is not a copy-on-write page or out of
+         * physical memory.
+         */
+        auto resolve_copy_on_write(const PageTable& base_pt, VirtualAddr v_addr) -> bool;
+
         /**
          * Load the base page table into the core CPU register if it is not already loaded.
          *
@@ -51,13 +51,34 @@ namespace Rune::SystemCall {
      */
     auto read_stdin(void* sys_call_ctx, U64 key_code_out) -> Ember::StatusCode;
 
+    /**
+     * @brief Read up to key_code_buf_size buffered keys from the stdin stream of the running app.
+     *
+     * In blocking mode the calling thread sleeps until at least one key is available, in
+     * non-blocking mode the system call returns immediately and can be used to poll stdin. At most
+     * Ember::STDIN_READ_KEY_LIMIT keys are returned by a single call.
+     *
+     * @param sys_call_ctx      A pointer to the app system call context.
+     * @param key_code_buf      A pointer to a keycode buffer, U16*.
+     * @param key_code_buf_size The number of keycodes that fit into the buffer.
+     * @param read_mode         An Ember::StdinReadMode.
+     * @return >=0:      The number of key codes written to the buffer.<br>
+     *          BAD_ARG: The key code buffer is null, empty or intersects kernel memory or the read
+     *                   mode is unknown.
+     */
+    auto read_stdin_keys(void* sys_call_ctx, U64 key_code_buf, U64 key_code_buf_size, U64 read_mode)
+        -> Ember::StatusCode;
+
     /**
      * @brief Write at most msg_size characters of the msg to the stdout stream of the running app.
+     *
+     * The msg is written directly from user memory in chunks, no kernel copy of it is made.
+     *
      * @param sys_call_ctx A pointer to the app system call context.
      * @param msg          A pointer to a c string.
      * @param msg_size     The length of the c string.
      * @return >=0:      The number of written characters.<br>
-     *          BAD_ARG: The msg is null, intersects kernel memory or exceeds the string size limit.
+     *          BAD_ARG: The msg is null, intersects kernel memory or is not mapped.
      */
     auto write_stdout(void* sys_call_ctx, U64 msg, U64 msg_size) -> Ember::StatusCode;
 
@@ -70,7 +91,7 @@ namespace Rune::SystemCall {
      * @param msg          A pointer to a c string.
      * @param msg_size     The length of the c string.
      * @return >=0:      The number of written characters.<br>
-     *          BAD_ARG: The msg is null, intersects kernel memory or exceeds the string size limit.
+     *          BAD_ARG: The msg is null, intersects kernel memory or is not mapped.
      */
     auto write_stderr(void* sys_call_ctx, U64 msg, U64 msg_size) -> Ember::StatusCode;
 
@@ -118,6 +139,28 @@ namespace Rune::SystemCall {
                    U64   stdout_config,
                    U64   stderr_config) -> Ember::StatusCode;
 
+    /**
+     * @brief Start a copy-on-write clone of the calling app whose main thread runs the entry
+     * function.
+     *
+     * <p>
+     *  The clone shares all memory of the calling app copy-on-write, so it starts with the
+     * current memory state of the caller without loading the executable again. It inherits the
+     * working directory and standard streams of the caller, but no open nodes, directory streams
+     * or wait sets. The entry function is passed a copy of the start info of the calling app and
+     * runs on the stack below stack_top in the clone.
+     * </p>
+     *
+     * @param sys_call_ctx A pointer to the app system call context.
+     * @param entry        Main function of the clone.
+     * @param stack_top    Initial stack pointer of the clone, e.g. just below the stack pointer of
+     * the caller.
+     * @return >0:       The clone has been started, the returned value is the assigned ID.<br>
+     *          BAD_ARG: The entry function or stack top are null or intersect kernel memory.<br>
+     *          FAULT:   The stack top is not in writable memory or the clone could not be started.
+     */
+    auto app_clone(void* sys_call_ctx, U64 entry, U64 stack_top) -> Ember::StatusCode;
+
     /**
      * @brief Exit the currently running app with the given exit code.
      * @param sys_call_ctx A pointer to the app system call context.
@@ -160,6 +203,136 @@ namespace Rune::SystemCall {
      *          IO:             An IO error happened.
      */
     auto app_change_directory(void* sys_call_ctx, U64 wd) -> Ember::StatusCode;
+
+    /**
+     * @brief Create a wait set for the running app, it lets a thread wait for many events at once.
+     * @param sys_call_ctx A pointer to the app system call context.
+     * @return >0:     The handle of the wait set.<br>
+     *          FAULT: The app has no wait set handles left.
+     */
+    auto wait_set_create(void* sys_call_ctx) -> Ember::StatusCode;
+
+    /**
+     * @brief Add an event to a wait set of the running app.
+     *
+     * The event source is identified by the event type and resource, see Ember::WaitEventType.
+     * Every event source can only be added once.
+     *
+     * @param sys_call_ctx A pointer to the app system call context.
+     * @param ID           Handle of the wait set.
+     * @param event_type   An Ember::WaitEventType.
+     * @param resource     Handle of the event source, e.g. a node handle.
+     * @param user_data    Reported back with the event.
+     * @return OKAY:               The event is added to the wait set.<br>
+     *          BAD_ARG:           The event type is unknown or the event is already added.<br>
+     *          UNKNOWN_ID:        The wait set or event source does not exist.<br>
+     *          NODE_IS_DIRECTORY: The node is not a file.
+     */
+    auto wait_set_add(void* sys_call_ctx, U64 ID, U64 event_type, U64 resource, U64 user_data)
+        -> Ember::StatusCode;
+
+    /**
+     * @brief Remove an event from a wait set of the running app.
+     * @param sys_call_ctx A pointer to the app system call context.
+     * @param ID           Handle of the wait set.
+     * @param event_type   An Ember::WaitEventType.
+     * @param resource     Handle of the event source.
+     * @return OKAY:        The event is removed from the wait set.<br>
+     *          UNKNOWN_ID: The wait set does not exist or does not contain the event.
+     */
+    auto wait_set_remove(void* sys_call_ctx, U64 ID, U64 event_type, U64 resource)
+        -> Ember::StatusCode;
+
+    /**
+     * @brief Wait until at least one event of the wait set is ready or the timeout expires and
+     * write the ready events to the buffer.
+     *
+     * Events are level-triggered, an event is reported by every wait until it is no longer
+     * ready. At most Ember::WAIT_EVENT_LIMIT events are returned by a single call.
+     *
+     * @param sys_call_ctx    A pointer to the app system call context.
+     * @param ID              Handle of the wait set.
+     * @param events_out      A pointer to an event buffer, Ember::WaitEvent*.
+     * @param events_out_size The number of events that fit into the buffer.
+     * @param timeout_millis  0: Only poll the events, Ember::WAIT_FOREVER: Wait without a
+     * timeout, Else: Wait at most the amount of milliseconds.
+     * @return >=0:         The number of events written to the buffer, zero if the timeout
+     * expired.<br>
+     *          BAD_ARG:    The event buffer is null, empty or intersects kernel memory or another
+     * thread is waiting on the wait set.<br>
+     *          UNKNOWN_ID: The wait set does not exist.
+     */
+    auto wait_set_wait(void* sys_call_ctx,
+                       U64   ID,
+                       U64   events_out,
+                       U64   events_out_size,
+                       U64   timeout_millis) -> Ember::StatusCode;
+
+    /**
+     * @brief Free a wait set of the running app.
+     * @param sys_call_ctx A pointer to the app system call context.
+     * @param ID           Handle of the wait set.
+     * @return OKAY:        The wait set is freed.<br>
+     *          UNKNOWN_ID: The wait set does not exist.
+     */
+    auto wait_set_free(void* sys_call_ctx, U64 ID) -> Ember::StatusCode;
+
+    /**
+     * Tracing records the arguments, status and TSC cycles of every system call the app makes and
+     * adds the cycles to the latency histogram of the system call.
+     *
+     * @brief Start or stop tracing the system calls of an app.
+     * @param sys_call_ctx A pointer to the app system call context.
+     * @param app_handle   Handle of the app.
+     * @param enable       0: Stop tracing, Else: Start tracing.
+     * @return OKAY:        The trace state of the app is updated.<br>
+     *          UNKNOWN_ID: The app does not exist.<br>
+     *          FAULT:      Too many apps are traced.
+     */
+    auto trace_system_calls(void* sys_call_ctx, U64 app_handle, U64 enable) -> Ember::StatusCode;
+
+    /**
+     * The cursor is the sequence number of the next record to read, start with zero and pass the
+     * updated cursor to the next call to get the records that were traced in the meantime.
+     *
+     * @brief Read the system call trace records of a CPU core.
+     * @param sys_call_ctx     A pointer to the app system call context.
+     * @param core_id          ID of the CPU core.
+     * @param cursor           A pointer to the trace cursor, U64*.
+     * @param records_out      A pointer to a record buffer, Ember::SystemCallTraceRecord*.
+     * @param records_out_size The number of records that fit into the buffer.
+     * @return >=0:         The number of records written to the buffer.<br>
+     *          BAD_ARG:    The cursor or record buffer is null, empty or intersects kernel
+     * memory.<br>
+     *          UNKNOWN_ID: The CPU core has no trace, e.g. because no app was traced yet.
+     */
+    auto read_system_call_trace(void* sys_call_ctx,
+                                U64   core_id,
+                                U64   cursor,
+                                U64   records_out,
+                                U64   records_out_size) -> Ember::StatusCode;
+
+    /**
+     * @brief Read the latency statistics of all system calls that were made by traced apps.
+     * @param sys_call_ctx   A pointer to the app system call context.
+     * @param stats_out      A pointer to a statistics buffer, Ember::SystemCallStats*.
+     * @param stats_out_size The number of statistics that fit into the buffer.
+     * @return >=0:      The number of statistics written to the buffer.<br>
+     *          BAD_ARG: The buffer is null, empty or intersects kernel memory.
+     */
+    auto read_system_call_stats(void* sys_call_ctx, U64 stats_out, U64 stats_out_size)
+        -> Ember::StatusCode;
+
+    /**
+     * @brief Read the resource usage of all running apps.
+     * @param sys_call_ctx   A pointer to the app system call context.
+     * @param usage_out      A pointer to a usage buffer, Ember::AppResourceUsage*.
+     * @param usage_out_size The number of usage records that fit into the buffer.
+     * @return >=0:      The number of usage records written to the buffer.<br>
+     *          BAD_ARG: The buffer is null, empty or intersects kernel memory.
+     */
+    auto read_resource_usage(void* sys_call_ctx, U64 usage_out, U64 usage_out_size)
+        -> Ember::StatusCode;
 } // namespace Rune::SystemCall
 
 #endif // RUNEOS_APPBUNDLE_H
@@ -19,15 +19,20 @@
 
 #include <KRE/Memory.h>
 
+#include <Memory/VirtualMemoryManager.h>
+
 namespace Rune::SystemCall {
     class KernelGuardian {
-        VirtualAddr _kernel_memory_start{0};
+        VirtualAddr                   _kernel_memory_start{0};
+        Memory::VirtualMemoryManager* _vmm{nullptr};
 
       public:
         KernelGuardian();
 
         void set_kernel_memory_start(VirtualAddr kernel_memory_start);
 
+        void set_virtual_memory_manager(Memory::VirtualMemoryManager* vmm);
+
         /**
          * @brief Verify that the user buffer is not null and check that it does not intersect with
          * kernel memory.
@@ -39,6 +44,32 @@ namespace Rune::SystemCall {
          */
         auto verify_user_buffer(void* user_buf, size_t user_buf_size) const -> bool;
 
+        /**
+         * @brief Verify the user buffer and check that all its pages are mapped and accessible from
+         * user mode, so the kernel can read or write it in place.
+         *
+         * <p>
+         *  The buffer is recorded in the pinned user memory of the calling thread. Other threads of
+         * the app cannot free pinned memory, therefore the pages stay mapped until the system call
+         * returns. Once the buffer is pinned it can be handed directly to the VFS and storage
+         * drivers, they translate it page by page for DMA, instead of copying it through a kernel
+         * buffer.
+         * </p>
+         * <p>
+         *  Devices bypass the page protection, so copy-on-write pages of a buffer the kernel will
+         * write to get their own page frame before the buffer is pinned.
+         * </p>
+         *
+         * @param user_buf      Pointer to a byte buffer in user mode memory.
+         * @param user_buf_size Size of the user mode buffer.
+         * @param write_access  True: The kernel will write to the buffer, all pages must be
+         * writable.
+         * @return True: The user buffer can be accessed in place until the system call returns,
+         * False: The user mode buffer is bad or not completely mapped.
+         */
+        auto pin_user_buffer(void* user_buf, size_t user_buf_size, bool write_access) const
+            -> bool;
+
         /**
          * @brief Verify the user and kernel memory buffer and then copy the content of the user
          * memory buffer to the kernel memory buffer.
@@ -17,6 +17,7 @@
 #ifndef RUNEOS_SYSTEMCALL_H
 #define RUNEOS_SYSTEMCALL_H
 
+#include <Ember/AppBits.h>
 #include <Ember/Ember.h>
 
 #include <KRE/Logging.h>
@@ -29,11 +30,19 @@ namespace Rune::SystemCall {
      * @brief General information about an installed system call.
      */
     struct SystemCallInfo {
-        U16    handle    = 0;
-        String name      = "";
-        U64    requested = 0;
+        U16                    handle    = 0;
+        String                 name      = "";
+        U64                    requested = 0;
+        Ember::SystemCallStats latency   = {};
     };
 
+    /// @brief Maximum number of apps whose system calls are traced at the same time.
+    constexpr U8 SYSTEM_CALL_TRACED_APP_LIMIT = 8;
+
+    /// @brief Number of records in the trace ring of a CPU core, when the ring is full the oldest
+    ///         record is overwritten.
+    constexpr U32 SYSTEM_CALL_TRACE_RING_SIZE = 512;
+
     /**
      * @brief Initialize the system call infrastructure, upon successful initialization the kernel
      * can handle system calls from user mode applications.
@@ -74,6 +83,37 @@ namespace Rune::SystemCall {
      * installed or the ID is invalid (systemCallID >= SystemCallLimit).
      */
     auto system_call_uninstall(U16 system_call_id) -> bool;
+
+    /**
+     * While an app is traced every system call it makes is timed with the time stamp counter and
+     * recorded in the trace ring of the CPU core that handled it, additionally the latency
+     * histogram of the system call is updated. System calls of untraced apps only increment the
+     * request counter.
+     *
+     * @brief Start or stop tracing the system calls of an app.
+     * @param app_handle Handle of the app.
+     * @param enable     True: Start tracing, False: Stop tracing.
+     * @return True: The trace state of the app is updated, False: SYSTEM_CALL_TRACED_APP_LIMIT apps
+     *          are already traced or the trace rings could not be allocated.
+     */
+    auto system_call_trace(U16 app_handle, bool enable) -> bool;
+
+    /**
+     * The cursor is the sequence number of the next record to read, it starts at zero and is
+     * advanced past all returned records. When records were overwritten before they were read,
+     * the cursor skips them.
+     *
+     * @brief Read the trace records of a CPU core in the order they were recorded.
+     * @param core_id  ID of the CPU core.
+     * @param cursor   Sequence number of the next record to read.
+     * @param buf      Buffer for the read records.
+     * @param buf_size Maximum number of records to read.
+     * @return >=0: Number of read records, -1: The CPU core has no trace ring.
+     */
+    auto system_call_trace_read(U8                            core_id,
+                                U64&                          cursor,
+                                Ember::SystemCallTraceRecord* buf,
+                                size_t                        buf_size) -> int;
 } // namespace Rune::SystemCall
 
 #endif // RUNEOS_SYSTEMCALL_H
@@ -98,6 +98,83 @@ namespace Rune::SystemCall {
      *          BAD_ARG: The tcb buffer is null or in kernel memory.
      */
     auto set_thread_control_block(void* sys_call_ctx, U64 tcb) -> Ember::StatusCode;
+
+    /**
+     * The thread runs in the address space of the calling app on its own user stack. Its main
+     * function is passed a start info with argc = 1 and argv = {arg, nullptr}, the argument itself
+     * is not interpreted by the kernel. A thread should end with exit_thread, because there is no
+     * function to return to from its main function.
+     *
+     * @brief Start a new thread in the calling app.
+     * @param sys_call_ctx A pointer to the thread management context.
+     * @param entry        Main function of the thread.
+     * @param arg          Argument that is passed to the thread in argv[0].
+     * @return >0:       The thread handle.<br>
+     *          BAD_ARG: The entry function is null or in kernel memory.<br>
+     *          FAULT:   The thread stack could not be allocated or the thread not be scheduled.
+     */
+    auto create_thread(void* sys_call_ctx, U64 entry, U64 arg) -> Ember::StatusCode;
+
+    /**
+     * The exit code of the thread is not kept, libc must pass the result of a thread to the
+     * joining thread on its own.
+     *
+     * @brief Block the calling thread until the requested thread of the calling app has exited.
+     * @param sys_call_ctx A pointer to the thread management context.
+     * @param ID           The ID of a thread.
+     * @return OKAY:        The thread has exited.<br>
+     *          BAD_ARG:    The ID is zero or the ID of the calling thread.<br>
+     *          UNKNOWN_ID: The calling app has no running thread with the ID.
+     */
+    auto join_thread(void* sys_call_ctx, U64 ID) -> Ember::StatusCode;
+
+    /**
+     * The user stack of the thread is freed. If the calling thread is the main thread of the app,
+     * the whole app exits as if app_exit was called.
+     *
+     * @brief Terminate the calling thread, the system call does not return.
+     * @param sys_call_ctx A pointer to the thread management context.
+     * @param exit_code    Exit code of the thread.
+     * @return Nothing.
+     */
+    auto exit_thread(void* sys_call_ctx, U64 exit_code) -> Ember::StatusCode;
+
+    /**
+     * @brief Give up the CPU so that other ready threads can run.
+     * @param sys_call_ctx A pointer to the thread management context.
+     * @return OKAY: The calling thread has been scheduled again.
+     */
+    auto yield_thread(void* sys_call_ctx) -> Ember::StatusCode;
+
+    /**
+     * The futex is identified by the address space of the calling app and the user space address,
+     * so threads of the same app wait on the same futex without having to register it first. The
+     * value check and the sleep happen atomically with respect to futex_wake, a wake up between
+     * the user space check of the futex value and the system call is not lost.
+     *
+     * @brief Block the calling thread while the futex has the expected value.
+     * @param sys_call_ctx   A pointer to the thread management context.
+     * @param futex          A pointer to a 4 byte aligned int in user space.
+     * @param expected       The value the futex must have for the thread to block.
+     * @param timeout_millis Maximum time to wait in milliseconds, WAIT_FOREVER waits without
+     *                        timeout.
+     * @return OKAY:                The thread was woken by futex_wake.<br>
+     *          BAD_ARG:             The futex is null, not aligned or in kernel memory.<br>
+     *          FUTEX_VALUE_CHANGED: The futex did not have the expected value.<br>
+     *          FUTEX_TIMED_OUT:     The thread was not woken before the timeout.
+     */
+    auto futex_wait(void* sys_call_ctx, U64 futex, U64 expected, U64 timeout_millis)
+        -> Ember::StatusCode;
+
+    /**
+     * @brief Wake up to count threads waiting on the futex in the order they started waiting.
+     * @param sys_call_ctx A pointer to the thread management context.
+     * @param futex        A pointer to a 4 byte aligned int in user space.
+     * @param count        Maximum number of threads to wake.
+     * @return >=0:      Number of woken threads.<br>
+     *          BAD_ARG: The futex is null, not aligned or in kernel memory.
+     */
+    auto futex_wake(void* sys_call_ctx, U64 futex, U64 count) -> Ember::StatusCode;
 } // namespace Rune::SystemCall
 
 #endif // RUNEOS_THREADMODULE_H
@@ -192,6 +192,26 @@ namespace Rune::SystemCall {
      *          UNKNOWN_ID:  No directory stream with the requested ID exists.
      */
     auto vfs_directory_stream_close(void* sys_call_ctx, U64 dir_stream_ID) -> Ember::StatusCode;
+
+    /// @brief Register the IO ring of the active app, a previously registered ring is replaced.
+    /// @param sys_call_ctx A pointer to the VFS context.
+    /// @param ring         Pointer to an Ember::IORing in user memory.
+    /// @return OKAY: The ring is registered.<br>
+    ///         BAD_ARG: The ring or one of its queues is null, intersects kernel memory or is not
+    ///                     mapped, or the entry count is not a power of two in
+    ///                     [1, IO_RING_ENTRY_LIMIT].
+    auto vfs_io_ring_setup(void* sys_call_ctx, U64 ring) -> Ember::StatusCode;
+
+    /// @brief Process the submissions in the IO ring of the active app.
+    ///
+    /// The submissions are processed in order and a completion is posted for each of them, the
+    /// processing stops when to_submit submissions were processed, the submission queue is empty
+    /// or the completion queue is full.
+    /// @param sys_call_ctx A pointer to the VFS context.
+    /// @param to_submit    Maximum number of submissions to process.
+    /// @return >= 0: The number of processed submissions.<br>
+    ///         BAD_ARG: The app has no IO ring or the ring is not valid anymore.
+    auto vfs_io_ring_enter(void* sys_call_ctx, U64 to_submit) -> Ember::StatusCode;
 } // namespace Rune::SystemCall
 
 #endif // RUNEOS_VFSBUNDLE_H
@@ -0,0 +1,135 @@
+/*
+ *  Copyright 2025 Ewogijk
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef RUNEOS_HANDLETABLETEST_H
+#define RUNEOS_HANDLETABLETEST_H
+
+#include <KRE/System/Resource.h>
+
+#include <Test/Heimdall/Heimdall.h>
+
+using namespace Rune;
+
+// ============================================================================================== //
+// Test Environment
+// ============================================================================================== //
+
+struct DummyResource {
+    int value;
+};
+
+auto make_dummy_resource(int value) -> SharedPointer<DummyResource> {
+    return SharedPointer<DummyResource>(new DummyResource{.value = value});
+}
+
+// ============================================================================================== //
+// Test Suite
+// ============================================================================================== //
+
+// ========================================================================================== //
+// acquire
+// ========================================================================================== //
+
+TEST("acquire - Handles are unique and never none", "HandleTable") {
+    HandleTable<DummyResource, U16> table;
+    U16                             first  = table.acquire();
+    U16                             second = table.acquire();
+    REQUIRE(first != Resource<U16>::HANDLE_NONE)
+    REQUIRE(second != Resource<U16>::HANDLE_NONE)
+    REQUIRE(first != second)
+    REQUIRE(table.size() == 2U)
+}
+
+TEST("acquire - Recycle removed slots", "HandleTable") {
+    HandleTable<DummyResource, U16> table;
+    // A long-running system opens and closes far more resources than a U16 can count
+    for (int i = 0; i < 70000; i++) {
+        U16 handle = table.acquire();
+        REQUIRE(handle != Resource<U16>::HANDLE_NONE)
+        REQUIRE(table.remove(handle))
+    }
+    REQUIRE(table.size() == 0U)
+    REQUIRE(table.has_more())
+}
+
+TEST("acquire - Out of slots", "HandleTable") {
+    HandleTable<DummyResource, U16> table;
+    while (table.has_more()) table.acquire();
+    REQUIRE(table.acquire() == Resource<U16>::HANDLE_NONE)
+}
+
+// ========================================================================================== //
+// find
+// ========================================================================================== //
+
+TEST("find - Hit", "HandleTable") {
+    HandleTable<DummyResource, U16> table;
+    U16                             handle = table.acquire();
+    REQUIRE(table.put(handle, make_dummy_resource(42)))
+    REQUIRE(table.find(handle)->value == 42)
+}
+
+TEST("find - Stale handle misses the resource reusing the slot", "HandleTable") {
+    HandleTable<DummyResource, U16> table;
+    U16                             stale = table.acquire();
+    table.put(stale, make_dummy_resource(1));
+    table.remove(stale);
+
+    // Slots are reused in FIFO order -> The only free slot is reused
+    U16 fresh = table.acquire();
+    table.put(fresh, make_dummy_resource(2));
+    REQUIRE(fresh != stale)
+    REQUIRE(!table.find(stale))
+    REQUIRE(!table.put(stale, make_dummy_resource(3)))
+    REQUIRE(!table.remove(stale))
+    REQUIRE(table.find(fresh)->value == 2)
+}
+
+// ========================================================================================== //
+// iterate
+// ========================================================================================== //
+
+TEST("iterate - Skip free and reserved slots", "HandleTable") {
+    HandleTable<DummyResource, U16> table;
+    U16                             first = table.acquire();
+    table.put(first, make_dummy_resource(1));
+    table.acquire(); // Reserved but empty
+    U16 removed = table.acquire();
+    table.put(removed, make_dummy_resource(3));
+    table.remove(removed);
+    U16 last = table.acquire();
+    table.put(last, make_dummy_resource(4));
+
+    int sum   = 0;
+    int count = 0;
+    for (const auto& resource : table) {
+        sum += resource->value;
+        count++;
+    }
+    REQUIRE(count == 2)
+    REQUIRE(sum == 5)
+}
+
+TEST("clear - All handles become stale", "HandleTable") {
+    HandleTable<DummyResource, U16> table;
+    U16                             handle = table.acquire();
+    table.put(handle, make_dummy_resource(1));
+    table.clear();
+    REQUIRE(table.size() == 0U)
+    REQUIRE(!table.find(handle))
+}
+
+#endif // RUNEOS_HANDLETABLETEST_H
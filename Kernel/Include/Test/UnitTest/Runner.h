@@ -26,6 +26,10 @@
 
 #include <Test/UnitTest/Device/DeviceModuleTest.h>
 
+#include <Test/UnitTest/KRE/System/HandleTableTest.h>
+
+#include <Test/UnitTest/VirtualFileSystem/FAT/DentryCacheTest.h>
+
 namespace Rune::Test {
     void run_kernel_tests();
 }
@@ -0,0 +1,177 @@
+/*
+ *  Copyright 2025 Ewogijk
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef RUNEOS_DENTRYCACHETEST_H
+#define RUNEOS_DENTRYCACHETEST_H
+
+#include <VirtualFileSystem/FAT/DentryCache.h>
+
+#include <Test/Heimdall/Heimdall.h>
+
+using namespace Rune;
+
+// ============================================================================================== //
+// Test Environment
+// ============================================================================================== //
+
+constexpr U32 DENTRY_PARENT_CLUSTER = 2;
+
+auto make_dummy_entry(const String& name, U32 location_cluster, U16 entry_idx)
+    -> VFS::LocationAwareFileEntry {
+    VFS::LocationAwareFileEntry entry;
+    entry.file_name      = name;
+    entry.file.file_size = 0;
+    entry.location       = {.cluster = location_cluster, .entry_idx = entry_idx};
+    return entry;
+}
+
+// ============================================================================================== //
+// Test Suite
+// ============================================================================================== //
+
+// ========================================================================================== //
+// lookup
+// ========================================================================================== //
+
+TEST("lookup - Miss", "DentryCache") {
+    VFS::DentryCache            cache;
+    VFS::LocationAwareFileEntry out;
+    REQUIRE(cache.lookup(DENTRY_PARENT_CLUSTER, "Foo.txt", out) == VFS::DentryLookupResult::MISS)
+}
+
+TEST("lookup - Hit", "DentryCache") {
+    VFS::DentryCache cache;
+    cache.insert(DENTRY_PARENT_CLUSTER,
+                 "Foo.txt",
+                 make_dummy_entry("Foo.txt", DENTRY_PARENT_CLUSTER, 3));
+
+    VFS::LocationAwareFileEntry out;
+    REQUIRE(cache.lookup(DENTRY_PARENT_CLUSTER, "Foo.txt", out) == VFS::DentryLookupResult::HIT)
+    REQUIRE((out.file_name == "Foo.txt"))
+    REQUIRE(out.location.entry_idx == 3U)
+    REQUIRE(cache.lookup(DENTRY_PARENT_CLUSTER + 1, "Foo.txt", out)
+            == VFS::DentryLookupResult::MISS)
+}
+
+TEST("lookup - Negative hit", "DentryCache") {
+    VFS::DentryCache cache;
+    cache.insert_negative(DENTRY_PARENT_CLUSTER, "Foo.txt");
+
+    VFS::LocationAwareFileEntry out;
+    REQUIRE(cache.lookup(DENTRY_PARENT_CLUSTER, "Foo.txt", out)
+            == VFS::DentryLookupResult::NEGATIVE_HIT)
+}
+
+// ========================================================================================== //
+// insert
+// ========================================================================================== //
+
+TEST("insert - Evict least recently used", "DentryCache") {
+    VFS::DentryCache cache;
+    for (U32 i = 0; i < VFS::DentryCache::CAPACITY; i++)
+        cache.insert_negative(DENTRY_PARENT_CLUSTER, int_to_string(i, Radix::DECIMAL));
+    REQUIRE(cache.size() == VFS::DentryCache::CAPACITY)
+
+    // Touch the oldest dentry, so the second oldest is evicted
+    VFS::LocationAwareFileEntry out;
+    REQUIRE(cache.lookup(DENTRY_PARENT_CLUSTER, "0", out) == VFS::DentryLookupResult::NEGATIVE_HIT)
+    cache.insert_negative(DENTRY_PARENT_CLUSTER, "New");
+
+    REQUIRE(cache.size() == VFS::DentryCache::CAPACITY)
+    REQUIRE(cache.lookup(DENTRY_PARENT_CLUSTER, "0", out) == VFS::DentryLookupResult::NEGATIVE_HIT)
+    REQUIRE(cache.lookup(DENTRY_PARENT_CLUSTER, "1", out) == VFS::DentryLookupResult::MISS)
+    REQUIRE(cache.lookup(DENTRY_PARENT_CLUSTER, "New", out)
+            == VFS::DentryLookupResult::NEGATIVE_HIT)
+}
+
+TEST("insert - Replace negative dentry", "DentryCache") {
+    VFS::DentryCache cache;
+    cache.insert_negative(DENTRY_PARENT_CLUSTER, "Foo.txt");
+    cache.insert(DENTRY_PARENT_CLUSTER,
+                 "Foo.txt",
+                 make_dummy_entry("Foo.txt", DENTRY_PARENT_CLUSTER, 3));
+
+    VFS::LocationAwareFileEntry out;
+    REQUIRE(cache.size() == 1U)
+    REQUIRE(cache.lookup(DENTRY_PARENT_CLUSTER, "Foo.txt", out) == VFS::DentryLookupResult::HIT)
+}
+
+// ========================================================================================== //
+// update
+// ========================================================================================== //
+
+TEST("update - Update file entry", "DentryCache") {
+    VFS::DentryCache cache;
+    cache.insert(DENTRY_PARENT_CLUSTER,
+                 "Foo.txt",
+                 make_dummy_entry("Foo.txt", DENTRY_PARENT_CLUSTER, 3));
+
+    auto updated           = make_dummy_entry("", DENTRY_PARENT_CLUSTER, 3);
+    updated.file.file_size = 42;
+    cache.update(updated);
+
+    VFS::LocationAwareFileEntry out;
+    REQUIRE(cache.lookup(DENTRY_PARENT_CLUSTER, "Foo.txt", out) == VFS::DentryLookupResult::HIT)
+    REQUIRE(out.file.file_size == 42U)
+    REQUIRE((out.file_name == "Foo.txt"))
+}
+
+TEST("update - Deleted file entry", "DentryCache") {
+    VFS::DentryCache cache;
+    cache.insert(DENTRY_PARENT_CLUSTER,
+                 "Foo.txt",
+                 make_dummy_entry("Foo.txt", DENTRY_PARENT_CLUSTER, 3));
+
+    auto deleted                        = make_dummy_entry("", DENTRY_PARENT_CLUSTER, 3);
+    deleted.file.short_name.as_array[0] = VFS::FileEntry::MARK_EMPTY_MIDDLE;
+    cache.update(deleted);
+
+    VFS::LocationAwareFileEntry out;
+    REQUIRE(cache.size() == 0U)
+    REQUIRE(cache.lookup(DENTRY_PARENT_CLUSTER, "Foo.txt", out) == VFS::DentryLookupResult::MISS)
+}
+
+// ========================================================================================== //
+// invalidate
+// ========================================================================================== //
+
+TEST("invalidate - Remove dentry", "DentryCache") {
+    VFS::DentryCache cache;
+    cache.insert_negative(DENTRY_PARENT_CLUSTER, "Foo.txt");
+    cache.insert_negative(DENTRY_PARENT_CLUSTER, "Bar.txt");
+    cache.invalidate(DENTRY_PARENT_CLUSTER, "Foo.txt");
+
+    VFS::LocationAwareFileEntry out;
+    REQUIRE(cache.size() == 1U)
+    REQUIRE(cache.lookup(DENTRY_PARENT_CLUSTER, "Foo.txt", out) == VFS::DentryLookupResult::MISS)
+    REQUIRE(cache.lookup(DENTRY_PARENT_CLUSTER, "Bar.txt", out)
+            == VFS::DentryLookupResult::NEGATIVE_HIT)
+}
+
+TEST("invalidate_directory - Remove all dentries of the directory", "DentryCache") {
+    VFS::DentryCache cache;
+    cache.insert_negative(DENTRY_PARENT_CLUSTER, "Foo.txt");
+    cache.insert_negative(DENTRY_PARENT_CLUSTER, "Bar.txt");
+    cache.insert_negative(DENTRY_PARENT_CLUSTER + 1, "Foo.txt");
+    cache.invalidate_directory(DENTRY_PARENT_CLUSTER);
+
+    VFS::LocationAwareFileEntry out;
+    REQUIRE(cache.size() == 1U)
+    REQUIRE(cache.lookup(DENTRY_PARENT_CLUSTER + 1, "Foo.txt", out)
+            == VFS::DentryLookupResult::NEGATIVE_HIT)
+}
+
+#endif // RUNEOS_DENTRYCACHETEST_H
@@ -96,6 +96,21 @@ namespace Rune::VFS {
          */
         virtual auto unmount(Device::Handle mass_storage_dev_handle) -> MountStatus = 0;
 
+        /**
+         * A filesystem driver may keep filesystem metadata of a mounted storage device in memory
+         * and delay writing it back.
+         *
+         * @brief Write all cached filesystem metadata of the storage device back to it.
+         *
+         * @see VFS::VFSModule::sync()
+         *
+         * @param mass_storage_dev_handle ID of a storage device.
+         *
+         * @return True: The storage device is up to date, False: The storage device is not mounted
+         *          or an IO error happened.
+         */
+        virtual auto sync(Device::Handle mass_storage_dev_handle) -> bool = 0;
+
         //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
         //                                          File Manipulations
         //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
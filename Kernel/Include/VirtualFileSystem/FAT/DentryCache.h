@@ -0,0 +1,168 @@
+/*
+ *  Copyright 2025 Ewogijk
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef RUNEOS_DENTRYCACHE_H
+#define RUNEOS_DENTRYCACHE_H
+
+#include <Ember/Enum.h>
+
+#include <KRE/Collections/HashMap.h>
+
+#include <VirtualFileSystem/FAT/FAT.h>
+
+namespace Rune::VFS {
+
+#define DENTRY_LOOKUP_RESULTS(X)                                                                   \
+    X(DentryLookupResult, HIT, 0x1)                                                                \
+    X(DentryLookupResult, NEGATIVE_HIT, 0x2)                                                       \
+    X(DentryLookupResult, MISS, 0x3)
+
+    /// @brief Result of a dentry cache lookup.
+    ///
+    /// Hit: The file entry is cached.<br>
+    /// NegativeHit: It is cached that the directory has no file entry with the name.<br>
+    /// Miss: Nothing is known about the name, the directory must be searched.
+    DECLARE_ENUM(DentryLookupResult, DENTRY_LOOKUP_RESULTS, 0x0) // NOLINT
+
+    /**
+     * @brief Cache of resolved path components of a mounted volume.
+     *
+     * <p>
+     *  A dentry maps the name of a file entry in a directory to the file entry, so resolving a path
+     * does not need to search each directory on the path again. Dentries are keyed by the first
+     * cluster of the parent directory and the hash of the name. Names that were not found are
+     * cached as negative dentries.
+     * </p>
+     * <p>
+     *  The cache holds at most CAPACITY dentries, the least recently used dentry is evicted when a
+     * new one is needed.
+     * </p>
+     */
+    class DentryCache {
+      public:
+        static constexpr U32 CAPACITY = 256;
+
+      private:
+        static constexpr U32 NONE = 0xFFFFFFFF;
+
+        struct Dentry {
+            U32                    parent_cluster = 0;
+            String                 name           = "";
+            bool                   used           = false;
+            bool                   negative       = false; // The name does not exist in the parent
+            LocationAwareFileEntry entry          = {};
+            // Neighbours in the LRU list, the free list is linked through "lru_next"
+            U32 lru_prev = NONE;
+            U32 lru_next = NONE;
+        };
+
+        Dentry*           _dentries;
+        HashMap<U64, U32> _index;     // Dentry key -> Dentry index
+        U32               _lru_head;  // Most recently used dentry
+        U32               _lru_tail;  // Least recently used dentry
+        U32               _free_head; // First unused dentry
+        U32               _size;
+
+        static auto make_key(U32 parent_cluster, const String& name) -> U64;
+
+        void lru_unlink(U32 idx);
+
+        void lru_push_front(U32 idx);
+
+        void remove(U32 idx);
+
+        /**
+         * @brief Get the dentry for the name in the parent directory, if none exists an unused
+         * dentry is taken or the least recently used dentry is evicted.
+         * @param parent_cluster
+         * @param name
+         * @return The dentry, it is marked as most recently used.
+         */
+        auto acquire(U32 parent_cluster, const String& name) -> Dentry&;
+
+      public:
+        DentryCache();
+
+        ~DentryCache();
+
+        DentryCache(const DentryCache&)                    = delete;
+        DentryCache(DentryCache&&)                         = delete;
+        auto operator=(const DentryCache&) -> DentryCache& = delete;
+        auto operator=(DentryCache&&) -> DentryCache&      = delete;
+
+        /**
+         * @brief
+         * @return Number of cached dentries.
+         */
+        [[nodiscard]] auto size() const -> U32;
+
+        /**
+         * @brief Search the cache for a file entry in a directory.
+         * @param parent_cluster First cluster of the directory.
+         * @param name           Name of the file entry.
+         * @param out            The file entry if it is cached.
+         * @return Hit: The file entry is in "out", NegativeHit: The file entry does not exist,
+         *          Miss: The file entry is not cached.
+         */
+        auto lookup(U32 parent_cluster, const String& name, LocationAwareFileEntry& out)
+            -> DentryLookupResult;
+
+        /**
+         * @brief Cache the file entry that was found in a directory.
+         * @param parent_cluster First cluster of the directory.
+         * @param name           Name of the file entry.
+         * @param entry
+         */
+        void insert(U32 parent_cluster, const String& name, const LocationAwareFileEntry& entry);
+
+        /**
+         * @brief Cache that a directory has no file entry with the name.
+         * @param parent_cluster First cluster of the directory.
+         * @param name
+         */
+        void insert_negative(U32 parent_cluster, const String& name);
+
+        /**
+         * The dentry is found by the location of the file entry on the volume. If the file entry
+         * was deleted, the dentry is removed.
+         *
+         * @brief Update the cached copy of a file entry that was written to the volume.
+         * @param entry
+         */
+        void update(const LocationAwareFileEntry& entry);
+
+        /**
+         * @brief Remove the dentry of a name in a directory.
+         * @param parent_cluster First cluster of the directory.
+         * @param name
+         */
+        void invalidate(U32 parent_cluster, const String& name);
+
+        /**
+         * @brief Remove all dentries in a directory, e.g. because it was deleted and its cluster
+         * could be reused.
+         * @param dir_cluster First cluster of the directory.
+         */
+        void invalidate_directory(U32 dir_cluster);
+
+        /**
+         * @brief Remove all dentries.
+         */
+        void clear();
+    };
+} // namespace Rune::VFS
+
+#endif // RUNEOS_DENTRYCACHE_H
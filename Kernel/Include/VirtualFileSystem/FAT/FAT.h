@@ -22,6 +22,8 @@
 
 #include <KRE/String.h>
 
+#include <KRE/Collections/LinkedList.h>
+
 #include <Device/Device.h>
 
 namespace Rune::VFS {
@@ -350,12 +352,16 @@ namespace Rune::VFS {
             .entry_idx = 0}; // Location of the first LFN entry on the volume
     };
 
+    class FATNode;
+
     /**
      * Mapping of a storage device ID to a BPB.
      */
     struct MassStorageDevRef {
         Device::Handle      m_mass_storage_dev_handle = -1;
         BIOSParameterBlock* m_BPB                     = nullptr;
+        // Open nodes on the storage, nodes of the same file keep their buffers coherent with it
+        LinkedList<FATNode*> m_open_nodes;
 
         MassStorageDevRef(Device::Handle mass_storage_dev_handle, BIOSParameterBlock* bpb);
 
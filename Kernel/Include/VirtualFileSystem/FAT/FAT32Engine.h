@@ -49,6 +49,8 @@ namespace Rune::VFS {
 
         auto get_backup_boot_record_sector(BIOSParameterBlock* bpb) -> U16 override;
 
+        auto get_fs_info_sector(BIOSParameterBlock* bpb) -> U16 override;
+
         auto get_root_directory_cluster(BIOSParameterBlock* bpb) -> U32 override;
 
         auto get_max_cluster_count() -> U32 override;
@@ -0,0 +1,224 @@
+/*
+ *  Copyright 2025 Ewogijk
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef RUNEOS_FATCACHE_H
+#define RUNEOS_FATCACHE_H
+
+#include <KRE/Memory.h>
+
+#include <VirtualFileSystem/FAT/FAT.h>
+#include <VirtualFileSystem/FAT/FATEngine.h>
+
+namespace Rune::VFS {
+
+    /**
+     * @brief In-memory copy of the first FAT of a mounted volume.
+     *
+     * <p>
+     *  The FAT is divided into windows of WINDOW_SIZE bytes. A window is loaded from the volume the
+     * first time one of its entries is accessed and stays in memory until the cache is destroyed.
+     * Small volumes therefore have their whole FAT pinned in memory, for large volumes at most
+     * MAX_WINDOW_COUNT windows are kept and the least recently used window is evicted when a new
+     * one is needed.
+     * </p>
+     * <p>
+     *  Updates are only applied to the cached window and the modified sectors are marked dirty.
+     * flush() writes all dirty sectors to every FAT copy on the volume, so the backup FATs are
+     * mirrored lazily instead of on each update.
+     * </p>
+     * <p>
+     *  Additionally, a bitmap of all free clusters is built when the FAT is loaded and kept in sync
+     * with every update, so free clusters are found without touching the FAT. The free cluster
+     * count and the next free cluster hint are mirrored to the FSInfo sector of the volume on
+     * flush, if the volume has one.
+     * </p>
+     */
+    class FATCache {
+        /// @brief A window never spans more than a page, so a window transfer is physically
+        /// contiguous.
+        static constexpr U32 WINDOW_SIZE = 4096;
+        /// @brief Upper bound of loaded windows (4 MiB of FAT).
+        static constexpr U32 MAX_WINDOW_COUNT = 1024;
+
+        struct Window {
+            U8* data       = nullptr;
+            U32 dirty_mask = 0; // Bit i is set when sector i of the window was modified
+            U64 last_used  = 0;
+        };
+
+        Device::Handle           _mass_storage_dev_handle;
+        BIOSParameterBlock*      _bpb;
+        SharedPointer<FATEngine> _fat_engine;
+
+        U32 _fat_size;           // Size of a single FAT in sectors
+        U32 _sectors_per_window; // Number of FAT sectors in a window
+        U32 _cluster_count;      // Number of FAT entries that describe a data cluster + 2
+
+        Window* _windows;
+        U32     _window_count;
+        U32     _loaded_window_count;
+        U64     _access_clock;
+
+        U64* _free_map; // Bit i is set when cluster i is free
+        U32  _free_count;
+        U32  _next_free;
+
+        U16  _fs_info_sector; // 0 if the volume has no FSInfo sector
+        U8*  _fs_info_buf;
+        bool _fs_info_dirty;
+
+        /**
+         * @brief Get the window containing the FAT sector, load it from the volume if it is not
+         * cached.
+         * @param window_idx Index of the window.
+         * @return The window or a nullptr if it could not be loaded.
+         */
+        auto get_window(U32 window_idx) -> Window*;
+
+        /**
+         * @brief Write all dirty sectors of the window to every FAT copy.
+         * @param window_idx Index of the window.
+         * @return True: The window is clean, False: A storage error happened.
+         */
+        auto flush_window(U32 window_idx) -> bool;
+
+        /**
+         * @brief Free the least recently used window, dirty windows are flushed before they are
+         * freed.
+         * @return True: A window was freed, False: No window could be freed.
+         */
+        auto evict_window() -> bool;
+
+        [[nodiscard]] auto window_sector_count(U32 window_idx) const -> U32;
+
+        [[nodiscard]] auto is_free(U32 cluster) const -> bool;
+
+        void mark_free(U32 cluster, bool free);
+
+        /**
+         * @brief Search the free cluster map for the next free cluster in [start, end).
+         * @param start
+         * @param end
+         * @return The free cluster or end if all clusters in the range are used.
+         */
+        [[nodiscard]] auto find_free(U32 start, U32 end) const -> U32;
+
+        /**
+         * @brief Read the FSInfo sector and take over its next free cluster hint if it is valid.
+         * @return True: The FSInfo sector was read or the volume has none, False: A storage error
+         * happened.
+         */
+        auto load_fs_info() -> bool;
+
+        /**
+         * @brief Write the free cluster count and next free cluster hint to the FSInfo sector.
+         * @return True: The FSInfo sector is up to date, False: A storage error happened.
+         */
+        auto flush_fs_info() -> bool;
+
+      public:
+        FATCache(Device::Handle           mass_storage_dev_handle,
+                 BIOSParameterBlock*      bpb,
+                 SharedPointer<FATEngine> fat_engine,
+                 U32                      cluster_count,
+                 U16                      fs_info_sector);
+
+        ~FATCache();
+
+        FATCache(const FATCache&)                    = delete;
+        FATCache(FATCache&&)                         = delete;
+        auto operator=(const FATCache&) -> FATCache& = delete;
+        auto operator=(FATCache&&) -> FATCache&      = delete;
+
+        /**
+         * @brief Load as many FAT windows as the cache can hold and build the free cluster map.
+         * @return True: The FAT windows are loaded, False: A storage error happened.
+         */
+        auto preload() -> bool;
+
+        /**
+         * @brief
+         * @return Number of FAT entries that describe data clusters including the two reserved
+         * entries.
+         */
+        [[nodiscard]] auto get_cluster_count() const -> U32;
+
+        /**
+         * @brief
+         * @return Number of free clusters on the volume.
+         */
+        [[nodiscard]] auto get_free_count() const -> U32;
+
+        /**
+         * @brief
+         * @return The cluster where the search for free clusters should start.
+         */
+        [[nodiscard]] auto get_next_free() const -> U32;
+
+        /**
+         * @brief Move the next free cluster hint, e.g. to skip clusters that should be kept free
+         * for the growth of a file.
+         * @param cluster
+         */
+        void set_next_free(U32 cluster);
+
+        /**
+         * Free runs are searched starting at the hint and the search wraps around at the end of the
+         * volume. The first free run that has at least min_length clusters is returned, if no such
+         * run exists the first free run is returned instead. The min_length can exceed the
+         * max_length to find a run with free clusters behind the returned ones.
+         *
+         * @brief Find a run of consecutive free clusters.
+         * @param hint       Cluster where the search starts.
+         * @param min_length Preferred minimum run length.
+         * @param max_length Maximum run length.
+         * @param out_first  First cluster of the run.
+         * @return Length of the run, 0 if no cluster is free.
+         */
+        auto find_free_run(U32 hint, U32 min_length, U32 max_length, U32& out_first) const -> U32;
+
+        /**
+         * @brief Read the FAT entry of a cluster.
+         * @param cluster
+         * @param out     The FAT entry if the cluster was read.
+         * @return True: The FAT entry was read, False: A storage error happened.
+         */
+        auto read(U32 cluster, U32& out) -> bool;
+
+        /**
+         * @brief Update the FAT entry of a cluster, the FAT sector is marked dirty and the free
+         * cluster map is updated.
+         * @param cluster
+         * @param fat_value New FAT entry.
+         * @return True: The FAT entry is updated, False: A storage error happened.
+         */
+        auto write(U32 cluster, U32 fat_value) -> bool;
+
+        /**
+         * @brief Write all dirty FAT sectors to all FAT copies and the FSInfo sector on the volume.
+         * @return True: All FAT copies are up to date, False: A storage error happened.
+         */
+        auto flush() -> bool;
+
+        /**
+         * @brief
+         * @return True: At least one FAT sector was modified and not yet flushed.
+         */
+        [[nodiscard]] auto is_dirty() const -> bool;
+    };
+} // namespace Rune::VFS
+
+#endif // RUNEOS_FATCACHE_H
@@ -74,6 +74,8 @@ namespace Rune::VFS {
 
         auto unmount(Device::Handle mass_storage_dev_handle) -> MountStatus override;
 
+        auto sync(Device::Handle mass_storage_dev_handle) -> bool override;
+
         [[nodiscard]] auto is_valid_file_path(const Path& path) const -> bool override;
 
         auto create(Device::Handle mass_storage_dev_handle, const Path& path, U8 attributes)
@@ -61,6 +61,14 @@ namespace Rune::VFS {
          */
         virtual auto get_backup_boot_record_sector(BIOSParameterBlock* bpb) -> U16 = 0;
 
+        /**
+         *
+         * @param bpb
+         *
+         * @return The FSInfo sector or 0 if the volume has none.
+         */
+        virtual auto get_fs_info_sector(BIOSParameterBlock* bpb) -> U16 = 0;
+
         /**
          *
          * @param bpb
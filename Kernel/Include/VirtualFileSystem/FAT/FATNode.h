@@ -48,6 +48,136 @@ namespace Rune::VFS {
 
         [[nodiscard]] auto processed_bytes() const -> U32;
 
+        //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+        //                                          Extent Map
+        //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+        /**
+         * @brief A run of consecutive clusters in the cluster chain of the file.
+         */
+        struct Extent {
+            U32 file_cluster;  // Index of the first cluster of the run in the cluster chain
+            U32 first_cluster; // First cluster of the run on the volume
+            U32 length;        // Number of clusters in the run
+        };
+
+        static constexpr U32 MIN_EXTENT_CAPACITY = 8;
+
+        // Run-length encoded cluster chain of the file, sorted by file_cluster
+        Extent* _extent_map{nullptr};
+        U32     _extent_count{0};
+        U32     _extent_capacity{0};
+        // The extent map is rebuilt when the cluster chain was modified
+        bool _extent_map_valid{false};
+
+        /**
+         * @brief Walk the cluster chain of the file and build the extent map if it is not valid.
+         */
+        void load_extent_map();
+
+        /**
+         * @brief Binary search the extent map for the run containing a cluster of the file.
+         * @param file_cluster Index of a cluster in the cluster chain.
+         * @return The extent or a nullptr if the cluster chain is shorter.
+         */
+        [[nodiscard]] auto find_extent(U32 file_cluster) const -> const Extent*;
+
+        /**
+         * Clusters beyond the end of the cluster chain will set the cursor to the end of the last
+         * cluster, so that the next write will append a new cluster.
+         *
+         * @brief Move the file cursor to the start of a cluster of the file.
+         * @param file_cluster Index of a cluster in the cluster chain.
+         */
+        void move_cursor(U32 file_cluster);
+
+        //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+        //                                          Read-Ahead
+        //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+        // Size of the first read-ahead window after sequential reading was detected
+        static constexpr U32 MIN_READ_AHEAD_SIZE = 16 * 1024;
+        // The read-ahead window doubles with every sequential read until it reaches this size
+        static constexpr U32 MAX_READ_AHEAD_SIZE = 128 * 1024;
+
+        // Clusters of the file that were read ahead, allocated on the first read-ahead
+        U8* _read_ahead_buf{nullptr};
+        // Index of the first cluster in the read-ahead buffer in the cluster chain
+        U32 _read_ahead_first{0};
+        // Number of clusters in the read-ahead buffer
+        U32 _read_ahead_count{0};
+        // Number of clusters that will be read ahead, 0 if the file is not read sequentially. Reads
+        // smaller than the window are served from the read-ahead buffer, larger reads of whole
+        // clusters go directly to the caller's buffer
+        U32 _read_ahead_window{0};
+        // Byte offset where the next read starts if the file is read sequentially
+        U32 _next_sequential_read{0};
+
+        /**
+         * @brief Grow the read-ahead window if the read continues the last read, otherwise stop
+         * reading ahead.
+         */
+        void update_read_ahead_window();
+
+        /**
+         * @brief Read the next clusters of the file starting at the file cursor into the read-ahead
+         * buffer, a read-ahead spanning several extents is split into one request per extent.
+         * @param window Number of clusters to read, at most the read-ahead buffer capacity.
+         * @return True: The clusters were read, False: A storage error happened.
+         */
+        auto read_ahead(U32 window) -> bool;
+
+        //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+        //                                          Write-Behind
+        //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+        // Maximum number of bytes that are buffered before they are written to the volume
+        static constexpr U32 WRITE_BEHIND_SIZE = 128 * 1024;
+        // Buffered clusters are written to the volume at the latest after this time (1s)
+        static constexpr U64 WRITE_BEHIND_TIMEOUT = 1000000000;
+
+        // Run of consecutive clusters that were written but not yet stored on the volume
+        U8* _write_behind_buf{nullptr};
+        // First cluster of the buffered run on the volume
+        U32 _write_behind_first{0};
+        // Number of clusters in the write-behind buffer
+        U32 _write_behind_count{0};
+        // Time in nanoseconds since system start when the first cluster was buffered
+        U64 _write_behind_start{0};
+
+        /**
+         * A cluster can only be buffered if it is already buffered or directly continues the
+         * buffered run, otherwise the buffered run is written to the volume first. Clusters that
+         * are not completely overwritten are loaded from the volume if they contain file data that
+         * must be kept, else they are zeroed.
+         *
+         * @brief Get the write-behind buffer of the current cluster.
+         * @param cluster_size
+         * @param keep_content True: The current content of the cluster must be kept.
+         * @return The buffer of the current cluster or a nullptr if a storage error happened.
+         */
+        auto get_write_behind_cluster(size_t cluster_size, bool keep_content) -> U8*;
+
+        /**
+         * @brief Write the buffered clusters to the volume with a single storage request.
+         * @return True: No clusters are buffered anymore, False: A storage error happened.
+         */
+        auto flush_write_behind() -> bool;
+
+        /**
+         * @brief
+         * @return True: The clusters are buffered for longer than WRITE_BEHIND_TIMEOUT.
+         */
+        [[nodiscard]] auto write_behind_expired() const -> bool;
+
+        /**
+         * Every node of a file has its own read-ahead and write-behind buffer. Clusters buffered by
+         * other nodes of the file must be on the volume before a node reads it, and after a node
+         * wrote the file the clusters other nodes have read ahead may be stale.
+         *
+         * @brief Write the buffered clusters of all other open nodes of the file to the volume.
+         * @param drop_read_ahead True: Also discard the read-ahead buffers of the other nodes.
+         * @return True: Other nodes buffer no clusters anymore, False: A storage error happened.
+         */
+        auto sync_file_nodes(bool drop_read_ahead) -> bool;
+
       public:
         FATNode(Function<void()>                 on_close,
                 Path                             path,
@@ -57,7 +187,12 @@ namespace Rune::VFS {
                 FileEntryManager*                file_entry_manager,
                 SharedPointer<MassStorageDevRef> mounted_storage);
 
-        ~FATNode() override = default;
+        ~FATNode() override;
+
+        FATNode(const FATNode&)                    = delete;
+        FATNode(FATNode&&)                         = delete;
+        auto operator=(const FATNode&) -> FATNode& = delete;
+        auto operator=(FATNode&&) -> FATNode&      = delete;
 
         [[nodiscard]] auto get_node_path() const -> Path override;
 
@@ -76,6 +211,8 @@ namespace Rune::VFS {
         [[nodiscard]] auto has_attribute(Ember::NodeAttribute f_attr) const -> bool override;
 
         auto set_attribute(Ember::NodeAttribute n_attr, bool val) -> bool override;
+
+        auto flush() -> bool override;
     };
 } // namespace Rune::VFS
 
@@ -20,6 +20,7 @@
 #include <Ember/Enum.h>
 #include <VirtualFileSystem/Path.h>
 
+#include <VirtualFileSystem/FAT/DentryCache.h>
 #include <VirtualFileSystem/FAT/FAT.h>
 #include <VirtualFileSystem/FAT/FATDirectoryIterator.h>
 #include <VirtualFileSystem/FAT/VolumeManager.h>
@@ -38,15 +39,76 @@ namespace Rune::VFS {
      * High level search and manipulations of FAT file entries.
      */
     class FileEntryManager {
+        /// @brief Number of clusters that are kept free after the first cluster run of a file, so
+        /// the file can grow without being fragmented.
+        static constexpr U32 EXTENT_PREALLOCATION = 16;
+
         SharedPointer<FATEngine> _fat_engine;
         VolumeManager*           _volume_manager;
 
+        HashMap<Device::Handle, SharedPointer<DentryCache>> _dentry_cache_table;
+
+        [[nodiscard]] auto find_dentry_cache(Device::Handle mass_storage_dev_handle) const
+            -> DentryCache*;
+
+        /**
+         * Mark a run of clusters as free in the FAT.
+         *
+         * @param mass_storage_dev_handle
+         * @param bpb
+         * @param first_cluster
+         * @param length
+         */
+        void free_cluster_run(Device::Handle      mass_storage_dev_handle,
+                              BIOSParameterBlock* bpb,
+                              U32                 first_cluster,
+                              U32                 length);
+
       public:
         explicit FileEntryManager(SharedPointer<FATEngine> fat_engine,
                                   VolumeManager*           volume_manager);
 
         /**
-         * Search for the file entry at the given path.
+         * Create an empty dentry cache for a mounted volume. Path components resolved by search()
+         * are cached from now on.
+         *
+         * @param mass_storage_dev_handle
+         */
+        void dentry_cache_load(Device::Handle mass_storage_dev_handle);
+
+        /**
+         * Remove the dentry cache of a volume that is unmounted.
+         *
+         * @param mass_storage_dev_handle
+         */
+        void dentry_cache_drop(Device::Handle mass_storage_dev_handle);
+
+        /**
+         * Remove the cached dentry of the file entry at the given path, e.g. because a file entry
+         * was created at a path that was cached as not existing.
+         *
+         * @param mass_storage_dev_handle
+         * @param bpb
+         * @param path
+         */
+        void dentry_cache_invalidate(Device::Handle      mass_storage_dev_handle,
+                                     BIOSParameterBlock* bpb,
+                                     const Path&         path);
+
+        /**
+         * Remove all cached dentries in a directory, e.g. because the directory was deleted and
+         * its cluster could be reused by another directory.
+         *
+         * @param mass_storage_dev_handle
+         * @param dir_cluster             First cluster of the directory.
+         */
+        void dentry_cache_invalidate_directory(Device::Handle mass_storage_dev_handle,
+                                               U32            dir_cluster);
+
+        /**
+         * Search for the file entry at the given path. Path components are looked up in the dentry
+         * cache of the volume first, only directories of uncached components are searched on the
+         * volume.
          *
          * @param mass_storage_dev_handle
          * @param bpb
@@ -88,7 +150,7 @@ namespace Rune::VFS {
 
         /**
          * Get the file entry from the storage device that the given entry points to and update it
-         * with the content of given entry.
+         * with the content of given entry. A cached dentry of the file entry is updated as well.
          *
          * @param mass_storage_dev_handle
          * @param bpb
@@ -115,6 +177,32 @@ namespace Rune::VFS {
                               BIOSParameterBlock*     bpb,
                               LocationAwareFileEntry& file,
                               U32                     last_file_cluster) -> U32;
+
+        /**
+         * Allocate new clusters for the given file and append them to its cluster chain.
+         *
+         * <p>
+         *  The clusters are allocated in runs of consecutive clusters. A file that is extended
+         * continues right after its last cluster if that cluster is free, otherwise a new run is
+         * started in a free area with room for at least EXTENT_PREALLOCATION clusters and the next
+         * free cluster hint of the volume is moved behind that area, so other files do not
+         * allocate the clusters the file is likely to grow into.
+         * </p>
+         *
+         * @param mass_storage_dev_handle
+         * @param bpb
+         * @param file
+         * @param last_file_cluster Currently last cluster of the file. Is zero for empty files.
+         * @param count             Number of clusters to allocate.
+         *
+         * @return Index of the first allocated cluster. 0 if no free cluster was found. If the
+         *          volume runs out of free clusters less than count clusters may be allocated.
+         */
+        auto allocate_clusters(Device::Handle          mass_storage_dev_handle,
+                               BIOSParameterBlock*     bpb,
+                               LocationAwareFileEntry& file,
+                               U32                     last_file_cluster,
+                               U32                     count) -> U32;
     };
 } // namespace Rune::VFS
 
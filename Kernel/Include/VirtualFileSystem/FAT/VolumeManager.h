@@ -17,7 +17,10 @@
 #ifndef RUNEOS_VOLUMEMANAGER_H
 #define RUNEOS_VOLUMEMANAGER_H
 
+#include <KRE/Collections/HashMap.h>
+
 #include <VirtualFileSystem/FAT/FAT.h>
+#include <VirtualFileSystem/FAT/FATCache.h>
 #include <VirtualFileSystem/FAT/FATEngine.h>
 
 namespace Rune::VFS {
@@ -26,7 +29,17 @@ namespace Rune::VFS {
      * Manages low level read/writes on the FAT and Data region of a volume.
      */
     class VolumeManager {
-        SharedPointer<FATEngine> _fat_engine;
+        SharedPointer<FATEngine>                         _fat_engine;
+        HashMap<Device::Handle, SharedPointer<FATCache>> _fat_cache_table;
+
+        /**
+         *
+         * @param mass_storage_dev_handle
+         *
+         * @return The FAT cache of the mass storage device or a nullptr if the FAT is not cached.
+         */
+        [[nodiscard]] auto find_fat_cache(Device::Handle mass_storage_dev_handle) const
+            -> FATCache*;
 
         /**
          *
@@ -50,6 +63,40 @@ namespace Rune::VFS {
          */
         [[nodiscard]] auto fat_get_eof_marker() const -> U32;
 
+        /**
+         * Load the FAT of a mounted volume into memory. All further FAT reads and writes of the
+         * volume are served from memory until the cache is dropped, modified FAT sectors are
+         * only written to the volume when the cache is flushed.
+         *
+         * @param mass_storage_dev_handle
+         * @param bpb
+         * @param cluster_count Number of data clusters on the volume.
+         *
+         * @return True: The FAT is cached, False: A storage error happened.
+         */
+        auto fat_cache_load(Device::Handle      mass_storage_dev_handle,
+                            BIOSParameterBlock* bpb,
+                            U32                 cluster_count) -> bool;
+
+        /**
+         * Write all modified FAT sectors to every FAT copy on the volume.
+         *
+         * @param mass_storage_dev_handle
+         *
+         * @return True: The FAT on the volume is up to date, False: A storage error happened.
+         */
+        auto fat_cache_flush(Device::Handle mass_storage_dev_handle) -> bool;
+
+        /**
+         * Flush and free the FAT cache of the volume.
+         *
+         * @param mass_storage_dev_handle
+         *
+         * @return True: The cache is dropped and the FAT on the volume is up to date, False: A
+         * storage error happened while flushing, the cache is dropped anyway.
+         */
+        auto fat_cache_drop(Device::Handle mass_storage_dev_handle) -> bool;
+
         /**
          * Read the FAT entry of a cluster.
          *
@@ -80,6 +127,7 @@ namespace Rune::VFS {
 
         /**
          * Search the FAT for a free cluster. The first free encountered cluster will be returned.
+         * If the FAT is cached the search does not access the volume.
          *
          * @param storage_dev
          * @param bpb
@@ -90,6 +138,37 @@ namespace Rune::VFS {
         auto fat_find_next_free_cluster(Device::Handle      mass_storage_dev_handle,
                                         BIOSParameterBlock* bpb) -> U32;
 
+        /**
+         * Search for a run of consecutive free clusters starting at the hint. The first run with at
+         * least min_length clusters is returned, if there is none the first free run is returned.
+         * Without a FAT cache the run is always a single cluster.
+         *
+         * @param mass_storage_dev_handle
+         * @param bpb
+         * @param hint       Cluster where the search starts, 0 to start at the next free cluster of
+         *                      the volume.
+         * @param min_length Preferred minimum run length.
+         * @param max_length Maximum run length.
+         * @param out_first  First cluster of the run.
+         *
+         * @return Length of the run. 0 if no cluster is free or a storage error happened.
+         */
+        auto fat_find_free_cluster_run(Device::Handle      mass_storage_dev_handle,
+                                       BIOSParameterBlock* bpb,
+                                       U32                 hint,
+                                       U32                 min_length,
+                                       U32                 max_length,
+                                       U32&                out_first) -> U32;
+
+        /**
+         * Move the next free cluster hint of the volume, allocations without a hint will start
+         * searching at this cluster.
+         *
+         * @param mass_storage_dev_handle
+         * @param cluster
+         */
+        void fat_set_next_free_cluster(Device::Handle mass_storage_dev_handle, U32 cluster);
+
         //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
         //                                          Data Region Manipulation
         //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -131,6 +210,40 @@ namespace Rune::VFS {
                                 BIOSParameterBlock* bpb,
                                 void*               buf,
                                 size_t              cluster) -> bool;
+
+        /**
+         * Read a run of consecutive data clusters with a single storage request.
+         *
+         * @param mass_storage_dev_handle
+         * @param bpb
+         * @param buf           Buffer to read the clusters into, must fit cluster_count clusters.
+         * @param first_cluster First cluster of the run.
+         * @param cluster_count Number of clusters in the run.
+         *
+         * @return True: All clusters were read. False: They were not.
+         */
+        auto data_cluster_run_read(Device::Handle      mass_storage_dev_handle,
+                                   BIOSParameterBlock* bpb,
+                                   void*               buf,
+                                   size_t              first_cluster,
+                                   size_t              cluster_count) const -> bool;
+
+        /**
+         * Overwrite a run of consecutive data clusters with a single storage request.
+         *
+         * @param mass_storage_dev_handle
+         * @param bpb
+         * @param buf           Buffer with data to write, must contain cluster_count clusters.
+         * @param first_cluster First cluster of the run.
+         * @param cluster_count Number of clusters in the run.
+         *
+         * @return True: All clusters were written. False: They were not.
+         */
+        auto data_cluster_run_write(Device::Handle      mass_storage_dev_handle,
+                                    BIOSParameterBlock* bpb,
+                                    void*               buf,
+                                    size_t              first_cluster,
+                                    size_t              cluster_count) -> bool;
     };
 } // namespace Rune::VFS
 
@@ -227,8 +227,20 @@ namespace Rune::VFS {
         virtual auto set_attribute(Ember::NodeAttribute n_attr, bool val) -> bool = 0;
 
         /**
-         * @brief Remove the node from the node table. If this is the last node pointing to the node
-         * path and it was requested to delete the file, it will also be physically deleted.
+         * <p>
+         *  Nodes may buffer written bytes and store them later in larger batches. The node is
+         *  flushed before it is closed.
+         * </p>
+         *
+         * @brief Write all buffered bytes to the storage device.
+         * @return True: No bytes are buffered anymore, False: A storage error happened.
+         */
+        virtual auto flush() -> bool = 0;
+
+        /**
+         * @brief Flush the node and remove it from the node table. If this is the last node
+         * pointing to the node path and it was requested to delete the file, it will also be
+         * physically deleted.
          */
         void close();
     };
@@ -48,6 +48,7 @@ namespace Rune::VFS {
     /// - DIRECTORY_STREAM_CLOSED: A directory stream has been opened. Event Context: The handle of
     ///     the closed directory stream, U16*.
     DECLARE_ENUM(EventHook, VFS_EVENT_HOOKS, 0x0) // NOLINT
+    VFS_EVENT_HOOKS(ASSERT_EVENT_HOOK_FITS)
 
     /**
      * @brief Mapping of a mount point (path) to a driver name and storage device ID.
@@ -144,17 +145,44 @@ namespace Rune::VFS {
         HashMap<Path, NodeRefCount> _node_ref_table;
 
         // All currently opened nodes
-        HashMap<U16, SharedPointer<Node>> _node_table;
-        HandleCounter<U16>                _node_handle_counter;
+        HandleTable<Node, U16> _node_table;
 
         // All currently opened directory streams
-        HashMap<U16, SharedPointer<DirectoryStream>> _dir_stream_table;
-        HandleCounter<U16>                           _dir_stream_handle_counter;
+        HandleTable<DirectoryStream, U16> _dir_stream_table;
+
+        // Upper bound of node paths with their own version, see touch_node()
+        static constexpr size_t NODE_VERSION_LIMIT = 1024;
+
+        // Version of every existing node path that was modified since boot, see get_node_version()
+        HashMap<Path, U64> _node_version_table;
+        U64                _node_version_clock = 0;
+        U64                _mount_version      = 0; // Version of the last mount/unmount
 
         [[nodiscard]] auto resolve(const Path& path) const -> MountPointInfo;
 
+        /**
+         * @brief Give the node path a new version, so caches of the node content become stale.
+         * @param path
+         */
+        void touch_node(const Path& path);
+
+        /**
+         * @brief Drop the version of a deleted node path, it falls back to the mount version until
+         * the node is created again.
+         * @param path
+         */
+        void forget_node(const Path& path);
+
         auto create_system_directory(const Path& path) -> bool;
 
+        /**
+         * @brief Write the cached filesystem metadata of the mount point back to its storage
+         * device.
+         * @param mpi
+         * @return True: The storage device is up to date, False: The driver failed to sync.
+         */
+        auto sync_mount_point(const MountPointInfo& mpi) -> bool;
+
       public:
         explicit VFSModule();
 
@@ -330,6 +358,21 @@ namespace Rune::VFS {
          */
         auto unmount(const Path& mount_point) -> MountStatus;
 
+        /**
+         * Flush the buffered bytes of all open nodes and write the cached filesystem metadata of
+         * all mounted storage devices back to them.
+         *
+         * <p>
+         *  Metadata is synced automatically when a node is created or deleted, when the last handle
+         * to a node is closed and when a storage device is unmounted. Sync must be called
+         * explicitly before the system is powered off.
+         * </p>
+         *
+         * @return True: All storage devices are up to date, False: At least one storage device
+         *          failed to sync.
+         */
+        auto sync() -> bool;
+
         //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
         //                                          Filesystem Access
         //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -378,6 +421,18 @@ namespace Rune::VFS {
         ///          NOT_FOUND:   No node with the ID was found.<br>
         auto get_node_info(NodeHandle node_handle, NodeInfo& out) -> IOStatus;
 
+        /**
+         * The version of a node path changes whenever the node is created, deleted or closed after
+         * it was opened for writing and when a storage device is mounted or unmounted. So content
+         * that was cached with the version of a node path is up to date as long as the version
+         * did not change. Versions are only meaningful during a single boot.
+         *
+         * @brief Get the current version of the node path.
+         * @param path Absolute path.
+         * @return The version of the node path.
+         */
+        [[nodiscard]] auto get_node_version(const Path& path) const -> U64;
+
         /**
          * Try to create a file/directory at the path with the given attributes. Either the
          * FileAttribute::Directory or FileAttribute::File attribute must be set otherwise the
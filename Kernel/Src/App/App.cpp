@@ -16,9 +16,20 @@
 
 #include <App/App.h>
 
+#include <KRE/Math.h>
+
 namespace Rune::App {
     DEFINE_ENUM(LoadStatus, LOAD_STATUSES, 0x0)
 
+    void ResourceUsage::add_heap_pages(const U64 pages) {
+        heap_pages      += pages;
+        peak_heap_pages  = max(peak_heap_pages, heap_pages);
+    }
+
+    void ResourceUsage::remove_heap_pages(const U64 pages) {
+        heap_pages -= min(pages, heap_pages);
+    }
+
     auto operator==(const Info& one, const Info& two) -> bool { return one.handle == two.handle; }
 
     auto operator!=(const Info& one, const Info& two) -> bool { return one.handle != two.handle; }
@@ -16,6 +16,7 @@
 
 #include <App/AppModule.h>
 
+#include <KRE/Math.h>
 #include <KRE/System/Lat15-Terminus16.h>
 #include <KRE/System/System.h>
 
@@ -24,6 +25,11 @@
 #include <App/TerminalStream.h>
 #include <App/VoidStream.h>
 
+#include <CPU/Threading/CriticalSection.h>
+#include <CPU/Threading/Stack.h>
+
+#include <SystemCall/SystemCall.h>
+
 #include <VirtualFileSystem/FileStream.h>
 
 namespace Rune::App {
@@ -47,13 +53,78 @@ namespace Rune::App {
                                                        app->base_page_table_address,
                                                        CPU::SchedulingPolicy::NORMAL,
                                                        user_stack);
-        app->handle = _app_handle_counter.acquire();
+        app->handle = _app_table.acquire();
         _app_table.put(app->handle, app);
-        _cpu_module->find_thread(t_id)->app_handle = app->handle;
+        const SharedPointer<CPU::Thread> main_thread = _cpu_module->find_thread(t_id);
+        main_thread->app_handle                      = app->handle;
+        main_thread->app                             = app.get();
         app->thread_table.add_back(t_id);
+        if (app->kernel_info != nullptr) {
+            app->kernel_info->app_handle    = app->handle;
+            app->kernel_info->thread_handle = t_id;
+        }
         return app->handle;
     }
 
+    void AppModule::free_user_space(Info* app) {
+        const Memory::PageTable base_pt =
+            Memory::interp_as_base_page_table(app->base_page_table_address);
+        // The kernel clock page frame is shared with all apps -> Only unmap it
+        if (app->kernel_info != nullptr) {
+            Memory::free_page(base_pt,
+                              memory_pointer_to_addr(app->kernel_info->clock),
+                              _memory_module->get_physical_memory_manager());
+        }
+        // Shared segments are freed by the segment cache -> Only unmap them
+        for (auto& segment : app->shared_segments) segment->unmap(base_pt);
+        app->shared_segments.clear();
+        if (!_memory_module->get_virtual_memory_manager()->free_virtual_address_space(
+                app->base_page_table_address)) {
+            LOGGER->warn(R"(Failed to free virtual address space of app "{}-{}")",
+                         app->handle,
+                         app->name);
+        }
+    }
+
+    auto AppModule::allocate_thread_stack() -> VirtualAddr {
+        Memory::VirtualMemoryManager* vmm       = _memory_module->get_virtual_memory_manager();
+        const MemorySize              page_size = Memory::get_page_size();
+        if (!_active_app->free_thread_stacks.empty()) {
+            const VirtualAddr stack_bottom = _active_app->free_thread_stacks.remove_front().value();
+            if (vmm->allocate(stack_bottom,
+                              Memory::PageFlag::PRESENT | Memory::PageFlag::WRITE_ALLOWED
+                                  | Memory::PageFlag::USER_MODE_ACCESS,
+                              THREAD_STACK_SIZE / page_size))
+                return stack_bottom;
+            vmm->free(stack_bottom, THREAD_STACK_SIZE / page_size);
+            _active_app->free_thread_stacks.add_front(stack_bottom);
+            return 0x0;
+        }
+
+        // The first stack ends where the kernel info area begins
+        if (_active_app->thread_stack_limit == 0x0)
+            _active_app->thread_stack_limit =
+                memory_pointer_to_addr(_active_app->kernel_info->clock) - page_size;
+        if (_active_app->thread_stack_limit
+            < _active_app->heap_limit + THREAD_STACK_SIZE + page_size) {
+            LOGGER->warn(R"(App "{}-{}" has no address space left for thread stacks.)",
+                         _active_app->handle,
+                         _active_app->name);
+            return 0x0;
+        }
+        const VirtualAddr stack_bottom = _active_app->thread_stack_limit - THREAD_STACK_SIZE;
+        if (!vmm->allocate(stack_bottom,
+                           Memory::PageFlag::PRESENT | Memory::PageFlag::WRITE_ALLOWED
+                               | Memory::PageFlag::USER_MODE_ACCESS,
+                           THREAD_STACK_SIZE / page_size)) {
+            vmm->free(stack_bottom, THREAD_STACK_SIZE / page_size);
+            return 0x0;
+        }
+        // Skip the guard page below the stack
+        _active_app->thread_stack_limit = stack_bottom - page_size;
+        return stack_bottom;
+    }
+
     auto AppModule::setup_file_stream(const SharedPointer<Info>& app,
                                       StdStream                  std_stream,
                                       const Path& file_path) -> SharedPointer<TextStream> {
@@ -122,7 +193,10 @@ namespace Rune::App {
           _vfs_module(nullptr),
           _dev_module(nullptr),
           _active_app(nullptr),
-          _system_loader_handle(0) {}
+          _system_loader_handle(0),
+          _kernel_clock_frame(0),
+          _image_cache(),
+          _segment_cache() {}
 
     auto AppModule::get_name() const -> String { return "App"; }
 
@@ -135,29 +209,42 @@ namespace Rune::App {
         _dev_module    = system.get_module<Device::DeviceModule>(ModuleSelector::DEVICE);
         _frame_buffer  = boot_info.framebuffer;
 
+        // Allocate the kernel clock page, the system timer publishes its time on every tick
+        if (!_memory_module->get_physical_memory_manager()->allocate(_kernel_clock_frame)) {
+            LOGGER->error("Failed to allocate the kernel clock page.");
+            return false;
+        }
+        void* kernel_clock = memory_addr_to_pointer<void>(
+            Memory::physical_to_virtual_address(_kernel_clock_frame));
+        memset(kernel_clock, 0, Memory::get_page_size());
+        _cpu_module->get_system_timer()->set_kernel_clock(
+            reinterpret_cast<Ember::KernelClock*>(kernel_clock));
+
         // Register event hooks
         LOGGER->debug("Registering eventhooks...");
         _cpu_module->install_event_handler(
-            CPU::EventHook(CPU::EventHook::THREAD_CREATED).to_string(),
+            CPU::EventHook::THREAD_CREATED,
             "App Thread Table Manager - ThreadCreated",
             [this](void* evt_ctx) -> void {
                 auto* t       = reinterpret_cast<CPU::Thread*>(evt_ctx);
                 t->app_handle = _active_app->handle;
+                t->app        = _active_app;
             });
         _cpu_module->install_event_handler(
-            CPU::EventHook(CPU::EventHook::THREAD_STOPPED).to_string(),
+            CPU::EventHook::THREAD_STOPPED,
             "App Thread Table Manager - ThreadTerminated",
             [this](void* evt_ctx) -> void {
                 // Find the app this thread belongs to
                 auto* tt_ctx = reinterpret_cast<CPU::ThreadPreemptionContext*>(evt_ctx);
-                SharedPointer<Info> finished_app(nullptr);
-                for (const auto& app_entry : _app_table) {
-                    auto& app = *app_entry.value;
-                    if (app->handle == tt_ctx->stopped->app_handle) {
-                        app->thread_table.remove(tt_ctx->stopped->get_handle());
-                        if (app->thread_table.empty()) finished_app = app;
-                        break;
-                    }
+                SharedPointer<Info> finished_app = _app_table.find(tt_ctx->stopped->app_handle);
+                if (finished_app) {
+                    // Keep the CPU time of the thread after it is gone
+                    finished_app->usage.user_cycles       += tt_ctx->stopped->user_cycles;
+                    finished_app->usage.kernel_cycles     += tt_ctx->stopped->kernel_cycles;
+                    finished_app->usage.system_call_count += tt_ctx->stopped->system_call_count;
+                    finished_app->thread_table.remove(tt_ctx->stopped->get_handle());
+                    if (!finished_app->thread_table.empty())
+                        finished_app = SharedPointer<Info>(nullptr);
                 }
 
                 // Finish app clean up -> Free base page table and app info struct
@@ -175,13 +262,16 @@ namespace Rune::App {
                                      finished_app->handle,
                                      finished_app->name);
 
+                    // Free the trace slot, no matter if the app exited or all its threads were
+                    // stopped
+                    SystemCall::system_call_trace(finished_app->handle, false);
                     _app_table.remove(finished_app->handle);
-                    // We currently have two refs to the finished app: 1. finishedApp and 2.
-                    // _active_app Both will be freed when this event handler finishes
-                    if (finished_app.get_ref_count() > 2) {
+                    // finished_app holds the last ref, the app info struct will be freed when this
+                    // event handler finishes
+                    if (finished_app.get_ref_count() > 1) {
                         LOGGER->warn(
 
-                            R"(>> Memory Leak << - "{}-{}" has {} references but expected 2.
+                            R"(>> Memory Leak << - "{}-{}" has {} references but expected 1.
                                     App info struct will not be freed.)",
                             finished_app->handle,
                             finished_app->name,
@@ -190,14 +280,8 @@ namespace Rune::App {
                 }
 
                 // Switch the active app if the next thread does belong to another app
-                // LOGGER->warn("Active App: {}", _active_app.get() != nullptr);
-                // LOGGER->warn("Next Scheduled: {}", tt_ctx->next_scheduled != nullptr);
-                if (_active_app->handle != tt_ctx->next_scheduled->app_handle) {
-                    SharedPointer<Info> next_active(nullptr);
-                    for (const auto& app_entry : _app_table) {
-                        auto& app = *app_entry.value;
-                        if (app->handle == tt_ctx->next_scheduled->app_handle) next_active = app;
-                    }
+                if (_active_app != tt_ctx->next_scheduled->app) {
+                    Info* next_active = tt_ctx->next_scheduled->app;
                     LOGGER->trace(R"(Switching running app: "{}" -> "{}")",
                                   _active_app->name,
                                   next_active ? next_active->name : "");
@@ -205,29 +289,25 @@ namespace Rune::App {
                 }
             });
         _cpu_module->install_event_handler(
-            CPU::EventHook(CPU::EventHook::THREAD_PREEMPTED).to_string(),
+            CPU::EventHook::THREAD_PREEMPTED,
             "App Thread Table Manager - ContextSwitch",
             [this](void* evt_ctx) -> void {
+                // Runs on every context switch -> No table lookups, logging is only done when
+                // tracing is enabled
                 auto* next = reinterpret_cast<CPU::Thread*>(evt_ctx);
-                // Switch the active app if the next thead belongs to another app
-                if (next->app_handle != _active_app->handle) {
-                    for (const auto& app_entry : _app_table) {
-                        auto& app = *app_entry.value;
-                        if (app->handle == next->app_handle) {
-                            LOGGER->trace(R"(Switching running app: "{}-{}" -> "{}-{}")",
-                                          _active_app->handle,
-                                          _active_app->name,
-                                          app->handle,
-                                          app->name);
-                            _active_app = app;
-                            break;
-                        }
-                    }
-                }
+                if (next->app == nullptr || next->app == _active_app) return;
+
+                if (LOGGER->get_log_level() == LogLevel::TRACE)
+                    LOGGER->trace(R"(Switching running app: "{}-{}" -> "{}-{}")",
+                                  _active_app->handle,
+                                  _active_app->name,
+                                  next->app->handle,
+                                  next->app->name);
+                _active_app = next->app;
             });
 
         _vfs_module->install_event_handler(
-            VFS::EventHook(VFS::EventHook::NODE_OPENED).to_string(),
+            VFS::EventHook::NODE_OPENED,
             "App Node Table Manager - On Open",
             [this](void* evt_ctx) -> void {
                 U16 handle = *reinterpret_cast<U16*>(evt_ctx);
@@ -238,7 +318,7 @@ namespace Rune::App {
                 _active_app->node_table.add_back(handle);
             });
         _vfs_module->install_event_handler(
-            VFS::EventHook(VFS::EventHook::NODE_CLOSED).to_string(),
+            VFS::EventHook::NODE_CLOSED,
             "App Node Table Manager - On Close",
             [this](void* evt_ctx) -> void {
                 U16 handle = *reinterpret_cast<U16*>(evt_ctx);
@@ -250,7 +330,7 @@ namespace Rune::App {
             });
 
         _vfs_module->install_event_handler(
-            VFS::EventHook(VFS::EventHook::DIRECTORY_STREAM_OPENED).to_string(),
+            VFS::EventHook::DIRECTORY_STREAM_OPENED,
             "App Directory Stream Table Manager - On Open",
             [this](void* evt_ctx) -> void {
                 U16 handle = *reinterpret_cast<U16*>(evt_ctx);
@@ -263,7 +343,7 @@ namespace Rune::App {
                 _active_app->directory_stream_table.add_back(handle);
             });
         _vfs_module->install_event_handler(
-            VFS::EventHook(VFS::EventHook::DIRECTORY_STREAM_CLOSED).to_string(),
+            VFS::EventHook::DIRECTORY_STREAM_CLOSED,
             "App Directory Stream Table Manager - On Close",
             [this](void* evt_ctx) -> void {
                 U16 handle = *reinterpret_cast<U16*>(evt_ctx);
@@ -285,7 +365,7 @@ namespace Rune::App {
                                .minor       = MINOR,
                                .patch       = PATCH,
                                .pre_release = PRERELEASE};
-        kernel_app->handle  = _app_handle_counter.acquire();
+        kernel_app->handle  = _app_table.acquire();
 
         // This is a dummy app that will be removed hence the standard IO streams are attached to
         // nothing
@@ -299,12 +379,13 @@ namespace Rune::App {
         for (auto& t : _cpu_module->get_thread_table()) {
             kernel_app->thread_table.add_back(t->get_handle());
             t->app_handle = kernel_app->handle;
+            t->app        = kernel_app.get();
         }
 
         for (auto& f_e : _vfs_module->get_node_table())
             kernel_app->node_table.add_back(f_e->handle);
 
-        _active_app = kernel_app;
+        _active_app = kernel_app.get();
         LOGGER->debug(R"(Initialize the kernel app "v{} " by {}.)",
                       kernel_app->name,
                       kernel_app->version.to_string(),
@@ -314,16 +395,59 @@ namespace Rune::App {
 
     auto AppModule::get_app_table() const -> LinkedList<Info*> {
         LinkedList<Info*> apps;
-        for (const auto& app_entry : _app_table) apps.add_back(app_entry.value->get());
+        for (const auto& app : _app_table) apps.add_back(app.get());
         return apps;
     }
 
-    auto AppModule::get_active_app() const -> Info* { return _active_app.get(); }
+    auto AppModule::get_active_app() const -> Info* { return _active_app; }
+
+    auto AppModule::find_app(U16 handle) const -> SharedPointer<Info> {
+        return _app_table.find(handle);
+    }
+
+    auto AppModule::is_user_memory_pinned(VirtualAddr start, MemorySize size) const -> bool {
+        // No thread of the app can be created or collected while interrupts are disabled
+        CPU::CriticalSection<CPU::InterruptSaveLock> _(_active_app->user_memory_lock);
+        const U16 running_handle = _cpu_module->get_scheduler()->get_running_thread()->get_handle();
+        for (const U16 t_handle : _active_app->thread_table) {
+            if (t_handle == running_handle) continue;
+            const SharedPointer<CPU::Thread> t = _cpu_module->find_thread(t_handle);
+            if (t && t->pinned_user_memory_start < start + size
+                && start < t->pinned_user_memory_end)
+                return true;
+        }
+        return false;
+    }
+
+    auto AppModule::get_resource_usage(const Info& app) const -> Ember::AppResourceUsage {
+        constexpr size_t NAME_LIMIT = Ember::STRING_SIZE_LIMIT - 1; // Keep the null terminator
+
+        Ember::AppResourceUsage usage;
+        memcpy(usage.name, app.name.to_cstr(), min(app.name.size(), NAME_LIMIT));
+        usage.user_cycles         = app.usage.user_cycles;
+        usage.kernel_cycles       = app.usage.kernel_cycles;
+        usage.heap_pages      = app.usage.heap_pages;
+        usage.peak_heap_pages = app.usage.peak_heap_pages;
+        usage.bytes_read          = app.usage.bytes_read;
+        usage.bytes_written       = app.usage.bytes_written;
+        usage.system_call_count   = app.usage.system_call_count;
+        usage.app_handle          = app.handle;
+        for (const auto t_handle : app.thread_table) {
+            const SharedPointer<CPU::Thread> t = _cpu_module->find_thread(t_handle);
+            if (!t) continue;
+            usage.user_cycles       += t->user_cycles;
+            usage.kernel_cycles     += t->kernel_cycles;
+            usage.system_call_count += t->system_call_count;
+            usage.thread_count++;
+        }
+        return usage;
+    }
 
     void AppModule::dump_app_table(const SharedPointer<TextStream>& stream) const {
-        constexpr U8 COLUMN_COUNT = 7;
+        constexpr U8 COLUMN_COUNT = 10;
         TableFormatter<SharedPointer<Info>, COLUMN_COUNT>::make_table(
             [this](const SharedPointer<Info>& info) -> Array<String, COLUMN_COUNT> {
+                const Ember::AppResourceUsage usage = get_resource_usage(*info);
                 return {
                     String::format("{}-{}", info->handle, info->name),
                     info->version.to_string(),
@@ -332,6 +456,9 @@ namespace Rune::App {
                     ID_list_to_string(info->thread_table),
                     ID_list_to_string(info->node_table),
                     ID_list_to_string(info->directory_stream_table),
+                    String::format("{}/{}", usage.user_cycles, usage.kernel_cycles),
+                    String::format("{}/{}", usage.heap_pages, usage.peak_heap_pages),
+                    String::format("{}/{}", usage.bytes_read, usage.bytes_written),
                 };
             })
             .with_headers({"ID-Name",
@@ -340,15 +467,22 @@ namespace Rune::App {
                            "Location",
                            "Thread Table",
                            "Node Table",
-                           "Directory Stream Table"})
+                           "Directory Stream Table",
+                           "User/Kernel Cycles",
+                           "Heap Pages/Peak",
+                           "Read/Written Bytes"})
             .with_data(_app_table.values())
             .print(stream);
     }
 
     auto AppModule::start_system_loader(const Path& system_loader_executable,
                                         const Path& working_directory) -> LoadStatus {
-        if (!_app_handle_counter.has_more()) return LoadStatus::LOAD_ERROR;
-        ELFLoader   loader(_memory_module, _vfs_module);
+        if (!_app_table.has_more()) return LoadStatus::LOAD_ERROR;
+        ELFLoader   loader(_memory_module,
+                           _vfs_module,
+                           _kernel_clock_frame,
+                           &_image_cache,
+                           &_segment_cache);
         auto        app = SharedPointer<Info>(new Info());
         CPU::Stack  user_stack;
         VirtualAddr start_info_addr = 0;
@@ -390,9 +524,12 @@ namespace Rune::App {
                                   const Ember::StdIOConfig& stdin_config,
                                   const Ember::StdIOConfig& stdout_config,
                                   const Ember::StdIOConfig& stderr_config) -> StartStatus {
-        if (!_app_handle_counter.has_more())
-            return {.load_result = LoadStatus::LOAD_ERROR, .handle = -1};
-        ELFLoader   loader(_memory_module, _vfs_module);
+        if (!_app_table.has_more()) return {.load_result = LoadStatus::LOAD_ERROR, .handle = -1};
+        ELFLoader   loader(_memory_module,
+                           _vfs_module,
+                           _kernel_clock_frame,
+                           &_image_cache,
+                           &_segment_cache);
         auto        app = SharedPointer<Info>(new Info());
         CPU::Stack  user_stack;
         VirtualAddr start_info_addr = 0;
@@ -444,6 +581,203 @@ namespace Rune::App {
         return {.load_result = LoadStatus::RUNNING, .handle = app_id};
     }
 
+    auto AppModule::clone_active_app(CPU::ThreadMain entry, VirtualAddr stack_top)
+        -> StartStatus {
+        if (!_app_table.has_more()) return {.load_result = LoadStatus::LOAD_ERROR, .handle = -1};
+        // The kernel app has no user space to clone
+        if (_active_app->kernel_info == nullptr)
+            return {.load_result = LoadStatus::LOAD_ERROR, .handle = -1};
+        SharedPointer<CPU::Thread> main_thread =
+            _cpu_module->find_thread(_active_app->kernel_info->thread_handle);
+        if (!main_thread) return {.load_result = LoadStatus::LOAD_ERROR, .handle = -1};
+
+        Memory::PhysicalMemoryManager* pmm = _memory_module->get_physical_memory_manager();
+        Memory::VirtualMemoryManager*  vmm = _memory_module->get_virtual_memory_manager();
+        PhysicalAddr                   base_pt_addr{0};
+        LOGGER->info(R"(Cloning app "{}-{}".)", _active_app->handle, _active_app->name);
+        if (!vmm->clone_virtual_address_space(_active_app->base_page_table_address, base_pt_addr)) {
+            LOGGER->warn("Failed to clone the virtual address space.");
+            return {.load_result = LoadStatus::MEMORY_ERROR, .handle = -1};
+        }
+        const Memory::PageTable base_pt = Memory::interp_as_base_page_table(base_pt_addr);
+
+        auto app                     = SharedPointer<Info>(new Info());
+        app->location                = _active_app->location;
+        app->name                    = _active_app->name;
+        app->vendor                  = _active_app->vendor;
+        app->version                 = _active_app->version;
+        app->base_page_table_address = base_pt_addr;
+        app->entry                   = reinterpret_cast<VirtualAddr>(entry);
+        app->kernel_info             = _active_app->kernel_info;
+        app->heap_start              = _active_app->heap_start;
+        app->heap_limit              = _active_app->heap_limit;
+        app->thread_stack_limit      = _active_app->thread_stack_limit;
+        app->free_thread_stacks      = _active_app->free_thread_stacks;
+        app->std_in                  = _active_app->std_in;
+        app->std_out                 = _active_app->std_out;
+        app->std_err                 = _active_app->std_err;
+        // The clone maps the same heap, the peak starts over with the child
+        app->usage.add_heap_pages(_active_app->usage.heap_pages);
+
+        // The kernel clock and shared segment page frames are only mapped by apps, but the clone
+        // took a reference to them -> Drop it again
+        pmm->free(_kernel_clock_frame);
+        for (auto& segment : _active_app->shared_segments) {
+            for (size_t i = 0; i < segment->get_page_count(); i++) {
+                PhysicalAddr frame = 0;
+                if (Memory::virtual_to_physical_address(
+                        memory_pointer_to_addr(segment->get_page(i)),
+                        frame))
+                    pmm->free(frame);
+            }
+            app->shared_segments.add_back(segment);
+        }
+        auto clone_failed = [this, pmm, &app](LoadStatus status) -> StartStatus {
+            free_user_space(app.get());
+            pmm->free(app->base_page_table_address);
+            return {.load_result = status, .handle = -1};
+        };
+
+        // The clone gets its own kernel info page, it is read-only for the app thus not
+        // copy-on-write
+        const MemorySize        page_size         = Memory::get_page_size();
+        const VirtualAddr       kernel_info_begin = memory_pointer_to_addr(app->kernel_info->clock)
+                                                  - page_size;
+        Memory::PageTableAccess pta               = Memory::find_page(base_pt, kernel_info_begin);
+        PhysicalAddr            kernel_info_frame{0};
+        if (pta.status != Memory::PageTableAccessStatus::OKAY
+            || !pmm->allocate(kernel_info_frame))
+            return clone_failed(LoadStatus::MEMORY_ERROR);
+        auto* kernel_info = memory_addr_to_pointer<Ember::KernelInfo>(
+            Memory::physical_to_virtual_address(kernel_info_frame));
+        memcpy(kernel_info, app->kernel_info, page_size);
+        Memory::remap_page(base_pt, kernel_info_begin, kernel_info_frame, pta.path[0].get_flags());
+        pmm->free(pta.path[0].get_address());
+        app->kernel_info = kernel_info;
+
+        // The start info and the null frame are placed below the stack top, these pages get their
+        // own page frames now so the writes below do not fault
+        constexpr size_t  start_info_size = sizeof(CPU::StartInfo);
+        const VirtualAddr start_info_addr =
+            memory_align(stack_top - start_info_size, sizeof(U64) * 2, false);
+        const VirtualAddr stack_end = start_info_addr + start_info_size;
+        for (VirtualAddr page = memory_align(start_info_addr - sizeof(U64), page_size, false);
+             page < stack_end;
+             page += page_size) {
+            pta = Memory::find_page(base_pt, page);
+            if (pta.status != Memory::PageTableAccessStatus::OKAY
+                || !pta.path[0].is_user_mode_access_allowed())
+                return clone_failed(LoadStatus::LOAD_ERROR);
+            if (pta.path[0].is_write_allowed()) continue;
+            if (!pta.path[0].is_copy_on_write() || !vmm->resolve_copy_on_write(base_pt, page))
+                return clone_failed(LoadStatus::LOAD_ERROR);
+        }
+
+        CPU::StartInfo start_info = *main_thread->start_info;
+        start_info.main           = entry;
+        CPU::Stack user_stack     = main_thread->user_stack;
+        {
+            CPU::CriticalSection<CPU::InterruptLock> _(_clone_lock);
+            const PhysicalAddr curr_app_vas = Memory::get_base_page_table_address();
+            vmm->load_virtual_address_space(base_pt_addr);
+            memcpy(memory_addr_to_pointer<void>(start_info_addr), &start_info, start_info_size);
+            user_stack.stack_top = CPU::setup_empty_stack(start_info_addr);
+            Memory::load_base_page_table(curr_app_vas);
+        }
+
+        int app_id = schedule_for_start(app,
+                                        user_stack,
+                                        memory_addr_to_pointer<CPU::StartInfo>(start_info_addr),
+                                        _active_app->working_directory);
+        return {.load_result = LoadStatus::RUNNING, .handle = app_id};
+    }
+
+    auto AppModule::start_thread(CPU::ThreadMain entry, void* arg) -> U16 {
+        // The kernel app has no user space to run the thread in
+        if (_active_app->kernel_info == nullptr) return 0;
+        SharedPointer<CPU::Thread> main_thread =
+            _cpu_module->find_thread(_active_app->kernel_info->thread_handle);
+        if (!main_thread) return 0;
+
+        // Interrupts stay disabled until the thread is in the thread table, else it could exit
+        // before it was added
+        CPU::CriticalSection<CPU::InterruptLock> _(_thread_lock);
+        const VirtualAddr stack_bottom = allocate_thread_stack();
+        if (stack_bottom == 0x0) return 0;
+
+        // The argv array and the start info are placed at the top of the stack, the calling
+        // thread belongs to the active app, so its address space is loaded
+        const VirtualAddr argv_addr = stack_bottom + THREAD_STACK_SIZE - (2 * sizeof(char*));
+        const VirtualAddr start_info_addr =
+            memory_align(argv_addr - sizeof(CPU::StartInfo), sizeof(U64) * 2, false);
+        auto* argv       = memory_addr_to_pointer<char*>(argv_addr);
+        argv[0]          = static_cast<char*>(arg);
+        argv[1]          = nullptr;
+        auto* start_info = memory_addr_to_pointer<CPU::StartInfo>(start_info_addr);
+        *start_info      = *main_thread->start_info;
+        start_info->argc = 1;
+        start_info->argv = argv;
+        start_info->main = entry;
+
+        const CPU::Stack user_stack = {.stack_bottom = memory_addr_to_pointer<void>(stack_bottom),
+                                       .stack_top    = CPU::setup_empty_stack(start_info_addr),
+                                       .stack_size   = THREAD_STACK_SIZE};
+        const U16        t_handle   = _cpu_module->schedule_new_thread(
+            String::format("{}-Thread", _active_app->name),
+            start_info,
+            _active_app->base_page_table_address,
+            main_thread->policy,
+            user_stack);
+        if (t_handle == 0) {
+            _memory_module->get_virtual_memory_manager()->free(
+                stack_bottom,
+                THREAD_STACK_SIZE / Memory::get_page_size());
+            _active_app->free_thread_stacks.add_back(stack_bottom);
+            return 0;
+        }
+        _active_app->thread_table.add_back(t_handle);
+        return t_handle;
+    }
+
+    void AppModule::exit_running_thread(int exit_code) {
+        // Use the raw pointer, the shared pointer would never be destroyed because the thread does
+        // not return from "thread_exit"
+        auto* r_t = _cpu_module->get_scheduler()->get_running_thread().get();
+        if (_active_app->kernel_info != nullptr
+            && r_t->get_handle() == _active_app->kernel_info->thread_handle)
+            exit_running_app(exit_code);
+
+        // The user stack is not touched anymore, the kernel runs on the kernel stack of the thread
+        const VirtualAddr stack_bottom = memory_pointer_to_addr(r_t->user_stack.stack_bottom);
+        const MemorySize  stack_size   = r_t->user_stack.stack_size;
+        if (stack_bottom != 0x0) {
+            CPU::CriticalSection<CPU::InterruptLock>     _(_thread_lock);
+            CPU::CriticalSection<CPU::InterruptSaveLock> m(_active_app->user_memory_lock);
+            if (is_user_memory_pinned(stack_bottom, stack_size)) {
+                // Another thread uses a buffer on the stack in a system call -> The stack stays
+                // mapped until the app exits
+                LOGGER->warn("The user stack of {} is pinned and will not be reused.",
+                             r_t->get_unique_name());
+            } else {
+                _memory_module->get_virtual_memory_manager()->free(
+                    stack_bottom,
+                    stack_size / Memory::get_page_size());
+                _active_app->free_thread_stacks.add_back(stack_bottom);
+            }
+        }
+        CPU::thread_exit(exit_code);
+    }
+
+    auto AppModule::join_thread(U16 handle) -> bool {
+        if (handle == _cpu_module->get_scheduler()->get_running_thread()->get_handle()
+            || !_active_app->thread_table.contains(handle))
+            return false;
+
+        // The thread may exit right after the check, then there is nothing to wait for anymore
+        _cpu_module->sync_with_thread_stop(handle);
+        return true;
+    }
+
     void AppModule::exit_running_app(int exit_code) {
         // The system loader is not allowed to exit!
         // While technically okay, this would lead to the system with only the idle thread running
@@ -464,22 +798,22 @@ namespace Rune::App {
         _active_app->std_err->close();
 
         LOGGER->debug(R"(App "{}-{}" has exited.)", _active_app->handle, _active_app->name);
-        LOGGER->debug("Freeing user mode memory...");
-        if (!_memory_module->get_virtual_memory_manager()->free_virtual_address_space(
-                _active_app->base_page_table_address)) {
-            LOGGER->warn(R"(Failed to free virtual address space of app "{}-{}")",
-                         _active_app->handle,
-                         _active_app->name);
-        }
 
         LOGGER->debug("Terminating all app threads...");
-        for (auto r_t : _active_app->thread_table) {
+        // The threads stay in the thread table until the garbage collector has stopped them, the
+        // app is freed with its last thread. Stopping a thread may switch to the garbage collector,
+        // therefore iterate over a copy of the table
+        const LinkedList<U16> app_threads = _active_app->thread_table;
+        for (auto r_t : app_threads) {
             if (!_cpu_module->stop_thread(r_t)
                 && r_t != _cpu_module->get_scheduler()->get_running_thread()->get_handle()) {
                 LOGGER->warn(R"(Failed to terminate thread with ID {}.)", r_t);
             }
         }
-        _active_app->thread_table.clear();
+
+        // No other thread of the app can run anymore
+        LOGGER->debug("Freeing user mode memory...");
+        free_user_space(_active_app);
 
         LOGGER->debug("Closing all open nodes of the app...");
         for (auto handle : _active_app->node_table) {
@@ -500,6 +834,11 @@ namespace Rune::App {
         }
         _active_app->joining_thread_table.clear();
 
+        LOGGER->debug("Freeing all wait sets and waking watchers of the app exit...");
+        _active_app->wait_set_table.clear();
+        _active_app->has_exited = true;
+        _active_app->exit_wait_queue.wake_all();
+
         CPU::thread_exit(exit_code);
     }
 
@@ -508,11 +847,7 @@ namespace Rune::App {
         // not get freed when the final context switch from its main thread to the next thread
         // happens after it has exited, otherwise the info gets freed, and it is no longer possible
         // to access its exit code.
-        SharedPointer<Info> app;
-        for (const auto& app_entry : _app_table) {
-            auto& a = *app_entry.value; // NOLINT app_table cannot contain null entries
-            if (a->handle == handle) app = a;
-        }
+        SharedPointer<Info> app = find_app(handle);
         if (!app) {
             LOGGER->debug(R"(No app with ID {} was found.)", handle);
             return INT_MAX;
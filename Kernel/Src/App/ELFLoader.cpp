@@ -211,6 +211,29 @@ namespace Rune::App {
         return LoadStatus::LOADED;
     }
 
+    auto ELFLoader::is_shared_segment(const ELF64File& elf_file, const size_t ph_idx) const
+        -> bool {
+        const auto& ph = elf_file.program_headers[ph_idx];
+        if (SegmentType(ph.type) != SegmentType::LOAD
+            || (ph.flags & SegmentPermission(SegmentPermission::WRITE).to_value()) != 0)
+            return false;
+
+        const MemorySize  page_size = Memory::get_page_size();
+        const VirtualAddr v_start   = memory_align(ph.virtual_address, page_size, false);
+        const VirtualAddr v_end =
+            memory_align(ph.virtual_address + ph.memory_size, page_size, true);
+        for (size_t i = 0; i < elf_file.program_headers.size(); i++) {
+            const auto& other = elf_file.program_headers[i];
+            if (i == ph_idx || SegmentType(other.type) != SegmentType::LOAD) continue;
+
+            const VirtualAddr other_start = memory_align(other.virtual_address, page_size, false);
+            const VirtualAddr other_end =
+                memory_align(other.virtual_address + other.memory_size, page_size, true);
+            if (v_start < other_end && other_start < v_end) return false;
+        }
+        return true;
+    }
+
     auto ELFLoader::allocate_segments(const ELF64File& elf64_file, VirtualAddr& heap_start)
         -> bool {
         Memory::VirtualMemoryManager* vmm = _memory_subsys->get_virtual_memory_manager();
@@ -227,6 +250,9 @@ namespace Rune::App {
             // Set the start of the app heap to the end of the app code area
             heap_start = max(v_end, heap_start);
 
+            // Shared segments are mapped from the segment cache when they are loaded
+            if (is_shared_segment(elf64_file, i)) continue;
+
             // Mark temporarily as writable until segment is copied, then update page flags with
             // actual segment flags
             constexpr U16 flags = Memory::PageFlag::PRESENT | Memory::PageFlag::WRITE_ALLOWED
@@ -246,7 +272,9 @@ namespace Rune::App {
                 // -> Need to only free the pages of prior program headers
                 for (size_t j = 0; j < i; j++) {
                     const auto& ph_old = elf64_file.program_headers[j];
-                    if (SegmentType(ph_old.type) != SegmentType::LOAD) continue;
+                    if (SegmentType(ph_old.type) != SegmentType::LOAD
+                        || is_shared_segment(elf64_file, j))
+                        continue;
 
                     const VirtualAddr v_start_old =
                         memory_align(ph_old.virtual_address, Memory::get_page_size(), false);
@@ -266,12 +294,86 @@ namespace Rune::App {
         return true;
     }
 
-    auto ELFLoader::load_segments(const ELF64File& elf_file) -> bool {
+    auto ELFLoader::fill_shared_segment(const ELF64ProgramHeader& ph, const SharedSegment& segment)
+        -> bool {
+        if (!seek(ph.offset)) return false;
+
+        const MemorySize page_size = Memory::get_page_size();
+        for (size_t i = 0; i < segment.get_page_count(); i++)
+            memset(segment.get_page(i), 0, page_size);
+
+        // The page frames are not mapped in the app yet -> Fill them through the higher half
+        // direct map
+        size_t to_copy    = ph.file_size;
+        size_t seg_offset = ph.virtual_address - segment.virtual_start;
+        while (to_copy > 0) {
+            const size_t page_offset = seg_offset % page_size;
+            const auto   chunk       = static_cast<U16>(min(to_copy, page_size - page_offset));
+            if (read_bytes(&segment.get_page(seg_offset / page_size)[page_offset], chunk) < chunk)
+                return false;
+            to_copy    -= chunk;
+            seg_offset += chunk;
+        }
+        return true;
+    }
+
+    auto ELFLoader::map_shared_segment(const ELF64ProgramHeader&  ph,
+                                       const Path&                executable,
+                                       const U64                  version,
+                                       const SharedPointer<Info>& entry_out) -> bool {
+        const MemorySize  page_size = Memory::get_page_size();
+        const VirtualAddr v_start   = memory_align(ph.virtual_address, page_size, false);
+        const VirtualAddr v_end =
+            memory_align(ph.virtual_address + ph.memory_size, page_size, true);
+
+        SharedPointer<SharedSegment> segment =
+            _segment_cache->find(executable, version, ph.offset);
+        if (segment) {
+            LOGGER->debug("Map cached segment: {:0=#16x}-{:0=#16x}", v_start, v_end);
+        } else {
+            segment = SharedPointer<SharedSegment>(
+                new SharedSegment(_memory_subsys->get_physical_memory_manager(),
+                                  executable,
+                                  version,
+                                  ph.offset,
+                                  v_start,
+                                  (v_end - v_start) / page_size));
+            if (!segment->is_allocated()) {
+                LOGGER->error("Failed to allocate page frames for {:0=#16x}-{:0=#16x}",
+                              v_start,
+                              v_end);
+                return false;
+            }
+            if (!fill_shared_segment(ph, *segment)) {
+                LOGGER->error("Failed to read segment {:0=#16x}-{:0=#16x}", v_start, v_end);
+                return false;
+            }
+            _segment_cache->insert(segment);
+        }
+
+        constexpr U16 flags = Memory::PageFlag::PRESENT | Memory::PageFlag::USER_MODE_ACCESS;
+        if (!segment->map(Memory::get_base_page_table(), flags)) {
+            LOGGER->error("Failed to map segment {:0=#16x}-{:0=#16x}", v_start, v_end);
+            return false;
+        }
+        entry_out->shared_segments.add_back(segment);
+        return true;
+    }
+
+    auto ELFLoader::load_segments(const ELF64File&           elf_file,
+                                  const Path&                executable,
+                                  const U64                  version,
+                                  const SharedPointer<Info>& entry_out) -> bool {
         const Memory::PageTable base_pt = Memory::get_base_page_table();
         for (size_t i = 0; i < elf_file.program_headers.size(); i++) {
             auto& ph = elf_file.program_headers[i];
             if (SegmentType(ph.type) != SegmentType::LOAD) continue;
 
+            if (is_shared_segment(elf_file, i)) {
+                if (!map_shared_segment(ph, executable, version, entry_out)) return false;
+                continue;
+            }
+
             // Skip to PH content in FILE
             if (!seek(ph.offset)) {
                 LOGGER->error("Failed to skip {:0=#16x} bytes to PH{} content.", ph.offset, i);
@@ -316,9 +418,43 @@ namespace Rune::App {
         return true;
     }
 
-    auto ELFLoader::setup_bootstrap_area(const ELF64File& elf_file,
-                                         char* args[], // NOLINT syscall arg, must use raw ptr
-                                         const size_t stack_size) -> CPU::StartInfo* {
+    auto ELFLoader::setup_kernel_info_area(const VirtualAddr kernel_info_begin)
+        -> Ember::KernelInfo* {
+        const MemorySize  page_size          = Memory::get_page_size();
+        const VirtualAddr kernel_clock_begin = kernel_info_begin + page_size;
+        const U16 read_only = Memory::PageFlag::PRESENT | Memory::PageFlag::USER_MODE_ACCESS;
+        if (!_memory_subsys->get_virtual_memory_manager()->allocate(kernel_info_begin, read_only)) {
+            LOGGER->error("Kernel info page allocation failed: {:0=#16x}", kernel_info_begin);
+            return nullptr;
+        }
+        // The kernel clock page is shared, every app maps the same page frame
+        if (Memory::allocate_page(Memory::get_base_page_table(),
+                                  kernel_clock_begin,
+                                  _kernel_clock_frame,
+                                  read_only,
+                                  _memory_subsys->get_physical_memory_manager())
+                .status
+            != Memory::PageTableAccessStatus::OKAY) {
+            LOGGER->error("Failed to map the kernel clock page: {:0=#16x}", kernel_clock_begin);
+            return nullptr;
+        }
+
+        // The app page is read-only -> Fill it through the higher half direct map
+        PhysicalAddr kernel_info_frame = 0;
+        if (!Memory::virtual_to_physical_address(kernel_info_begin, kernel_info_frame))
+            return nullptr;
+        auto* kernel_info = memory_addr_to_pointer<Ember::KernelInfo>(
+            Memory::physical_to_virtual_address(kernel_info_frame));
+        memset(kernel_info, 0, page_size);
+        kernel_info->clock     = memory_addr_to_pointer<Ember::KernelClock>(kernel_clock_begin);
+        kernel_info->page_size = page_size;
+        return kernel_info;
+    }
+
+    auto ELFLoader::setup_bootstrap_area(const ELF64File&    elf_file,
+                                         char*               args[], // NOLINT syscall arg
+                                         const size_t        stack_size,
+                                         Ember::KernelInfo*& kernel_info_out) -> CPU::StartInfo* {
         // Calculate the size of the bootstrap area
         constexpr size_t start_info_size = sizeof(CPU::StartInfo);
         constexpr size_t elf64_ph_size   = sizeof(ELF64ProgramHeader);
@@ -353,6 +489,12 @@ namespace Rune::App {
         }
         const VirtualAddr bootstrap_area_begin = stack_and_bootstrap_area_begin + stack_size;
 
+        // The kernel info area is placed directly below the stack
+        const VirtualAddr kernel_info_begin =
+            stack_and_bootstrap_area_begin - (KERNEL_INFO_AREA_PAGES * Memory::get_page_size());
+        kernel_info_out = setup_kernel_info_area(kernel_info_begin);
+        if (kernel_info_out == nullptr) return nullptr;
+
         // Setup argv and cla area
         auto** argv_area = reinterpret_cast<char**>(bootstrap_area_begin + start_info_size);
         auto*  cla_area =
@@ -386,14 +528,22 @@ namespace Rune::App {
         start_info->program_header_count   = elf_file.program_headers.size();
         start_info->main   = reinterpret_cast<CPU::ThreadMain>(elf_file.header.entry);
         start_info->random = &start_info->random_low;
+        start_info->kernel_info = memory_addr_to_pointer<Ember::KernelInfo>(kernel_info_begin);
 
         return start_info;
     }
 
-    ELFLoader::ELFLoader(Memory::MemoryModule* memory_module, VFS::VFSModule* vfs_subsys)
+    ELFLoader::ELFLoader(Memory::MemoryModule* memory_module,
+                         VFS::VFSModule*       vfs_subsys,
+                         PhysicalAddr          kernel_clock_frame,
+                         ImageCache*           image_cache,
+                         SegmentCache*         segment_cache)
         : _file_buf(),
           _memory_subsys(memory_module),
           _vfs_subsys(vfs_subsys),
+          _kernel_clock_frame(kernel_clock_frame),
+          _image_cache(image_cache),
+          _segment_cache(segment_cache),
           _load_lock() {}
 
     auto ELFLoader::load(const Path&                executable,
@@ -406,6 +556,7 @@ namespace Rune::App {
         // temporarily loaded, thus any allocations/frees during interrupt handling will be made in
         // the wrong VAS which leads to undefined behavior
         CPU::CriticalSection<CPU::InterruptLock> _(_load_lock);
+        const U64 version = _vfs_subsys->get_node_version(executable);
         if (const VFS::IOStatus io_status =
                 _vfs_subsys->open(executable, Ember::IOMode::READ, _elf_file);
             io_status != VFS::IOStatus::OPENED) {
@@ -413,9 +564,13 @@ namespace Rune::App {
             return LoadStatus::IO_ERROR;
         }
 
+        // Verification is skipped when the executable did not change since it was last verified
         ELF64File elf64_file;
-        if (const LoadStatus status = load_elf_file(elf64_file); status != LoadStatus::LOADED)
-            return status;
+        if (!_image_cache->find(executable, version, elf64_file)) {
+            if (const LoadStatus status = load_elf_file(elf64_file); status != LoadStatus::LOADED)
+                return status;
+            _image_cache->insert(executable, version, elf64_file);
+        }
 
         // Create virtual address space
         // To load the new app we will temporarily load it's new address space and allocate the
@@ -442,13 +597,14 @@ namespace Rune::App {
             return LoadStatus::MEMORY_ERROR;
         }
 
-        if (!load_segments(elf64_file)) {
+        if (!load_segments(elf64_file, executable, version, entry_out)) {
             LOGGER->error("Failed to load segments.");
             return LoadStatus::LOAD_ERROR;
         }
 
         constexpr MemorySize stack_size = 16 * MemoryUnit::KiB;
-        auto*                start_info = setup_bootstrap_area(elf64_file, args, stack_size);
+        Ember::KernelInfo*   kernel_info = nullptr;
+        auto* start_info = setup_bootstrap_area(elf64_file, args, stack_size, kernel_info);
         if (start_info == nullptr) {
             LOGGER->error("Bootstrap area setup failed.");
             return LoadStatus::MEMORY_ERROR;
@@ -469,6 +625,7 @@ namespace Rune::App {
         entry_out->entry                   = elf64_file.header.entry;
         entry_out->heap_start              = heap_start; // The heap starts after the ELF segments
         entry_out->heap_limit              = heap_start;
+        entry_out->kernel_info             = kernel_info;
 
         user_stack_out.stack_bottom =
             memory_addr_to_pointer<void>(start_info_addr_out - stack_size);
@@ -0,0 +1,62 @@
+/*
+ *  Copyright 2025 Ewogijk
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <App/ImageCache.h>
+
+namespace Rune::App {
+
+    ImageCache::ImageCache() : _hit_count(0), _miss_count(0) {}
+
+    auto ImageCache::find(const Path& executable, const U64 version, ELF64File& out) -> bool {
+        size_t idx = 0;
+        for (auto& image : _images) {
+            if (image.version == version && image.executable == executable) break;
+            idx++;
+        }
+        if (idx == _images.size()) {
+            _miss_count++;
+            return false;
+        }
+        _hit_count++;
+        if (idx > 0) {
+            Image image = move(_images.remove_at(idx).value());
+            _images.add_front(move(image));
+        }
+        out = _images.first().elf_file;
+        return true;
+    }
+
+    void ImageCache::insert(const Path& executable, const U64 version, const ELF64File& elf_file) {
+        // Drop older images of the executable, they can never be found again
+        size_t idx = 0;
+        while (idx < _images.size()) {
+            if (_images[idx].executable == executable) {
+                if (idx == 0)
+                    _images.remove_front();
+                else
+                    _images.remove_at(idx);
+            } else {
+                idx++;
+            }
+        }
+        if (_images.size() >= CAPACITY) _images.remove_back();
+        _images.add_front({.executable = executable, .version = version, .elf_file = elf_file});
+    }
+
+    auto ImageCache::get_hit_count() const -> size_t { return _hit_count; }
+
+    auto ImageCache::get_miss_count() const -> size_t { return _miss_count; }
+} // namespace Rune::App
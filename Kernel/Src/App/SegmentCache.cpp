@@ -0,0 +1,118 @@
+/*
+ *  Copyright 2025 Ewogijk
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <App/SegmentCache.h>
+
+namespace Rune::App {
+
+    SharedSegment::SharedSegment(Memory::PhysicalMemoryManager* pmm,
+                                 const Path&                    executable,
+                                 const U64                      version,
+                                 const U64                      file_offset,
+                                 const VirtualAddr              virtual_start,
+                                 const size_t                   page_count)
+        : _pmm(pmm),
+          _frames(new PhysicalAddr[page_count]),
+          _page_count(page_count),
+          _allocated_count(0),
+          executable(executable),
+          version(version),
+          file_offset(file_offset),
+          virtual_start(virtual_start) {
+        while (_allocated_count < _page_count && _pmm->allocate(_frames[_allocated_count]))
+            _allocated_count++;
+    }
+
+    SharedSegment::~SharedSegment() {
+        for (size_t i = 0; i < _allocated_count; i++) _pmm->free(_frames[i]);
+        delete[] _frames;
+    }
+
+    auto SharedSegment::is_allocated() const -> bool { return _allocated_count == _page_count; }
+
+    auto SharedSegment::get_page_count() const -> size_t { return _page_count; }
+
+    auto SharedSegment::get_page(const size_t page_idx) const -> U8* {
+        return memory_addr_to_pointer<U8>(Memory::physical_to_virtual_address(_frames[page_idx]));
+    }
+
+    auto SharedSegment::map(const Memory::PageTable& base_pt, const U16 flags) -> bool {
+        const MemorySize page_size = Memory::get_page_size();
+        for (size_t i = 0; i < _page_count; i++) {
+            if (Memory::allocate_page(base_pt,
+                                      virtual_start + (i * page_size),
+                                      _frames[i],
+                                      flags,
+                                      _pmm)
+                    .status
+                != Memory::PageTableAccessStatus::OKAY) {
+                for (size_t j = 0; j < i; j++)
+                    Memory::free_page(base_pt, virtual_start + (j * page_size), _pmm);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void SharedSegment::unmap(const Memory::PageTable& base_pt) {
+        const MemorySize page_size = Memory::get_page_size();
+        for (size_t i = 0; i < _page_count; i++)
+            Memory::free_page(base_pt, virtual_start + (i * page_size), _pmm);
+    }
+
+    void SegmentCache::evict() {
+        // Prefer the least recently used segment that no app maps anymore
+        size_t victim_idx = _segments.size() - 1;
+        size_t idx        = 0;
+        for (auto& segment : _segments) {
+            if (segment.get_ref_count() == 1) victim_idx = idx;
+            idx++;
+        }
+        const SharedPointer<SharedSegment> victim = _segments[victim_idx];
+        _segments.remove(victim);
+    }
+
+    SegmentCache::SegmentCache() : _hit_count(0), _miss_count(0) {}
+
+    auto SegmentCache::find(const Path& executable, const U64 version, const U64 file_offset)
+        -> SharedPointer<SharedSegment> {
+        SharedPointer<SharedSegment> found;
+        for (auto& segment : _segments) {
+            if (segment->version == version && segment->file_offset == file_offset
+                && segment->executable == executable) {
+                found = segment;
+                break;
+            }
+        }
+        if (!found) {
+            _miss_count++;
+            return found;
+        }
+        _hit_count++;
+        _segments.remove(found);
+        _segments.add_front(found);
+        return found;
+    }
+
+    void SegmentCache::insert(const SharedPointer<SharedSegment>& segment) {
+        if (_segments.size() >= CAPACITY) evict();
+        _segments.add_front(segment);
+    }
+
+    auto SegmentCache::get_hit_count() const -> size_t { return _hit_count; }
+
+    auto SegmentCache::get_miss_count() const -> size_t { return _miss_count; }
+} // namespace Rune::App
@@ -20,6 +20,7 @@
 
 #include <KRE/Math.h>
 
+#include <CPU/Threading/CriticalSection.h>
 #include <CPU/Time/Timer.h>
 
 #include <Memory/Paging.h>
@@ -155,9 +156,15 @@ namespace Rune::App {
             _state.scroll_back_buffer.add_back({});
             return;
         }
-        // Ditch the oldest entries to make space
-        while (_state.scroll_back_buffer.size() >= SCROLL_BACK_BUFFER_LIMIT)
+        // Ditch the oldest entries to make space, the cursor and viewport must stay on their lines
+        while (_state.scroll_back_buffer.size() >= SCROLL_BACK_BUFFER_LIMIT) {
             _state.scroll_back_buffer.remove_front();
+            if (_state.cursor_sbb.line > 0) _state.cursor_sbb.line--;
+            if (_state.viewport > 0)
+                _state.viewport--;
+            else
+                _state.screen_outdated = true; // The first line on the screen is gone
+        }
 
         // The newest lines are at the back, this makes the scroll back buffer chronologically
         // ordered
@@ -165,6 +172,16 @@ namespace Rune::App {
         _state.scroll_back_buffer.add_back({});
     }
 
+    void TerminalStream::new_line() {
+        scroll_back_buffer_append_new_line();
+        _state.cursor_sbb.line++;
+        _state.cursor_sbb.column = 0;
+        // A batch write scrolls once when it is done
+        if (!_state.defer_rendering
+            && _state.cursor_sbb.line - _state.viewport == _state.screen_height)
+            scroll_back(1);
+    }
+
     //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
     //                                          Render Functions
     //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -272,7 +289,11 @@ namespace Rune::App {
         }
 
         // Render the missing lines on the screen from the scroll back buffer
-        for (int i = render_line_begin; i < render_line_end; i++) {
+        render_lines(render_line_begin, render_line_end);
+    }
+
+    void TerminalStream::render_lines(int begin, int end) {
+        for (int i = begin; i < end; i++) {
             size_t y = i - _state.viewport;
             size_t x = 0;
             for (auto& st : _state.scroll_back_buffer[i].styled_text) {
@@ -283,20 +304,45 @@ namespace Rune::App {
         }
     }
 
+    void TerminalStream::redraw_screen() {
+        U64 terminal_line_pixels = _state.frame_buffer->get_pitch() * _state.font->pixel_height;
+        memset(static_cast<void*>(_state.frame_buffer->get_address()),
+               0,
+               _state.screen_height * terminal_line_pixels);
+        render_lines(_state.viewport,
+                     min(_state.viewport + _state.screen_height,
+                         static_cast<int>(_state.scroll_back_buffer.size())));
+        _state.screen_outdated = false;
+    }
+
+    void TerminalStream::render_deferred() {
+        // The lines below the screen are rendered from the scroll back buffer -> Apply the current
+        // style to the text of the last line, so it is rendered in the correct colors
+        scroll_back_buffer_get_last_line().style_raw_text(_state.bg_color, _state.fg_color);
+        if (_state.screen_outdated) {
+            if (!is_cursor_visible())
+                _state.viewport = max(_state.cursor_sbb.line - _state.screen_height + 1, 0);
+            redraw_screen();
+        } else {
+            scroll_to_cursor();
+        }
+    }
+
     void TerminalStream::draw_char(char ch) {
         start_cursor_movement();
-        _state.frame_buffer->draw_glyph(_state.font,
-                                        _state.cursor_sbb.column * _state.font->pixel_width,
-                                        (_state.cursor_sbb.line - _state.viewport)
-                                            * _state.font->pixel_height,
-                                        _state.bg_color,
-                                        _state.fg_color,
-                                        ch);
-        _state.cursor_sbb.column++;
-        if (_state.cursor_sbb.column >= _state.screen_width) {
-            _state.cursor_sbb.column = 0;
-            _state.cursor_sbb.line++;
+        // During a batch write the cursor can be below the screen, the line will be rendered from
+        // the scroll back buffer when the batch is done
+        if (is_cursor_visible()) {
+            _state.frame_buffer->draw_glyph(_state.font,
+                                            _state.cursor_sbb.column * _state.font->pixel_width,
+                                            (_state.cursor_sbb.line - _state.viewport)
+                                                * _state.font->pixel_height,
+                                            _state.bg_color,
+                                            _state.fg_color,
+                                            ch);
         }
+        _state.cursor_sbb.column++;
+        if (_state.cursor_sbb.column >= _state.screen_width) new_line();
         end_cursor_movement();
     }
 
@@ -332,12 +378,14 @@ namespace Rune::App {
     }
 
     void TerminalStream::start_cursor_movement() {
+        if (_state.defer_rendering) return; // The cursor is hidden during a batch write
         if (_state.is_cursor_rendered)
             // Clear the cursor at the current location
             draw_cursor(_state.default_bg_color);
     }
 
     void TerminalStream::end_cursor_movement() {
+        if (_state.defer_rendering) return; // The cursor is rendered when the batch is done
         // Draw it at the new position
         draw_cursor(_state.default_fg_color);
         _state.is_cursor_rendered      = true;
@@ -403,7 +451,8 @@ namespace Rune::App {
     }
 
     auto TerminalStream::exec_csi_command() -> void { // NOLINT TODO refactor if it will be expanded
-        _state.mutex->lock();
+        // CSI commands work on the screen -> Bring it up to date first
+        if (_state.defer_rendering) render_deferred();
         switch (_csi_cmd_selector) {
             case 'm':
                 // First append raw text buffer content with current color
@@ -606,7 +655,6 @@ namespace Rune::App {
         memset(_csi_argv.data(), 0, CSI_ARGV_BUF_SIZE);
         _csi_argc         = 0;
         _csi_cmd_selector = '\0';
-        _state.mutex->unlock();
     }
 
     auto TerminalStream::interpret_char(char ch) -> bool { // NOLINT typical parser
@@ -618,7 +666,6 @@ namespace Rune::App {
                 } else {
                     // Parse a C0 control code
                     bool ret = false;
-                    _state.mutex->lock();
                     switch (ch) {
                         case '\b':
                             start_cursor_movement();
@@ -639,11 +686,7 @@ namespace Rune::App {
                         }
                         case '\n':
                             start_cursor_movement();
-                            scroll_back_buffer_append_new_line();
-                            _state.cursor_sbb.line++;
-                            _state.cursor_sbb.column = 0;
-                            if (_state.cursor_sbb.line - _state.viewport == _state.screen_height)
-                                scroll_back(1);
+                            new_line();
                             end_cursor_movement();
                             ret = true;
                             break;
@@ -656,7 +699,6 @@ namespace Rune::App {
                             break;
                         default: break;
                     }
-                    _state.mutex->unlock();
                     return ret;
                 }
             case ANSIInterpreterState::CSI_BEGIN:
@@ -703,6 +745,28 @@ namespace Rune::App {
         }
     }
 
+    void TerminalStream::put_char(char ch) {
+        if (interpret_char(ch) || ch == '\0') return;
+        // Buffer the char first, drawing it can wrap the line
+        scroll_back_buffer_get_last_line().append_char(ch);
+        draw_char(ch);
+    }
+
+    auto TerminalStream::start_render_thread() -> bool {
+        if (!_initialized) return false;
+
+        if (_render_thread_ID == 0) {
+            _render_thread_ID = _cpu_module->schedule_new_thread(
+                "Terminal-Cursor Render Thread",
+                &_render_thread_start_info,
+                Memory::get_base_page_table_address(),
+                CPU::SchedulingPolicy::LOW_LATENCY,
+                {.stack_bottom = nullptr, .stack_top = 0x0, .stack_size = 0x0});
+            if (_render_thread_ID == 0) _initialized = false;
+        }
+        return _initialized;
+    }
+
     TerminalStream::TerminalStream(CPU::CPUModule* cpu_module,
                                    FrameBuffer*    frame_buffer,
                                    BitMapFont*     font,
@@ -749,28 +813,26 @@ namespace Rune::App {
     auto TerminalStream::is_write_supported() -> bool { return true; }
 
     auto TerminalStream::write(U8 value) -> bool {
-        if (!_initialized) return false;
-
-        if (_render_thread_ID == 0) {
-            _render_thread_ID = _cpu_module->schedule_new_thread(
-                "Terminal-Cursor Render Thread",
-                &_render_thread_start_info,
-                Memory::get_base_page_table_address(),
-                CPU::SchedulingPolicy::LOW_LATENCY,
-                {.stack_bottom = nullptr, .stack_top = 0x0, .stack_size = 0x0});
-            if (_render_thread_ID == 0) _initialized = false;
-        }
+        if (!start_render_thread()) return false;
 
-        char ch = static_cast<char>(value);
-        if (!interpret_char(ch) && ch != '\0') {
-            _state.mutex->lock();
-            draw_char(ch);
-            scroll_back_buffer_get_last_line().append_char(ch);
-            _state.mutex->unlock();
-        }
+        CPU::CriticalSection<CPU::Mutex> _(_state.mutex);
+        put_char(static_cast<char>(value));
         return true;
     }
 
+    auto TerminalStream::write_buffer(const char* buffer, size_t size) -> size_t {
+        if (!start_render_thread()) return 0;
+
+        CPU::CriticalSection<CPU::Mutex> _(_state.mutex);
+        start_cursor_movement();
+        _state.defer_rendering = true;
+        for (size_t i = 0; i < size; i++) put_char(buffer[i]);
+        _state.defer_rendering = false;
+        render_deferred();
+        end_cursor_movement();
+        return size;
+    }
+
     void TerminalStream::flush() {
         // No buffering is used
     }
@@ -56,4 +56,17 @@ pause:
 global get_page_fault_address
 get_page_fault_address:
     mov rax, cr2
-    ret
\ No newline at end of file
+    ret
+
+
+; CLINK U64 read_timestamp_counter();
+; Args:
+;   -
+; Returns:
+;   The current value of the time stamp counter.
+global read_timestamp_counter
+read_timestamp_counter:
+    rdtsc
+    shl rdx, 32
+    or rax, rdx     ; rax=edx:eax
+    ret
@@ -125,7 +125,7 @@ namespace Rune::CPU {
 
         U64 reserved_1;
 
-        // Interrupt stack table - Not used
+        // Interrupt stack table - ist_0 holds the stack of IST index 1
         U64 ist_0;
         U64 ist_1;
         U64 ist_2;
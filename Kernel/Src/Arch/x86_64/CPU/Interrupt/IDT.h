@@ -22,6 +22,12 @@
 
 namespace Rune::CPU {
 
+    /**
+     * @brief The double fault handler runs on its own stack, so a kernel stack overflow into a
+     * guard page ends in a double fault instead of a triple fault.
+     */
+    constexpr U8 DOUBLE_FAULT_IST = 1;
+
     /**
      * @brief Gate types define how the interrupt flag (IF) is handled whe an interrupt happens.
      * <ul>
@@ -29,7 +29,8 @@ namespace Rune::CPU {
     constexpr U8 IRQ_COUNT       = 224;
     constexpr U8 IRQ_NOT_PENDING = 255;
 
-    constexpr U8 PAGE_FAULT_VECTOR = 14;
+    constexpr U8 DOUBLE_FAULT_VECTOR = 8;
+    constexpr U8 PAGE_FAULT_VECTOR   = 14;
 
     /// Mapping of the first 32 interrupt codes (0..31) to exception names.
     const Array<const char*, EXCEPTION_COUNT> EXCEPTIONS = {"Divide by zero error",
@@ -136,7 +137,13 @@ namespace Rune::CPU {
         if (vector < EXCEPTION_COUNT) {
             // Handle exception
             const char* exception_name = EXCEPTIONS[vector];
-            if (!EXCEPTION_HANDLER_TABLE[vector].m_is_used) {
+            // A handler may only handle some cases of an exception, e.g. the page fault handler
+            // only resolves copy-on-write faults -> Other cases are as fatal as having no handler
+            InterruptState i_state = InterruptState::PENDING;
+            if (EXCEPTION_HANDLER_TABLE[vector].m_is_used)
+                i_state =
+                    EXCEPTION_HANDLER_TABLE[vector].m_handler(forward<InterruptFrame*>(&i_frame));
+            if (i_state == InterruptState::PENDING) {
                 if (PANIC_STREAM && PANIC_STREAM->is_write_supported()) {
                     // Dump the state of the current core
                     PANIC_STREAM->set_background_color(Pixie::VSCODE_RED);
@@ -162,17 +169,6 @@ namespace Rune::CPU {
                 }
                 while (true) __asm__("hlt");
             }
-            InterruptState i_state =
-                EXCEPTION_HANDLER_TABLE[vector].m_handler(forward<InterruptFrame*>(&i_frame));
-
-            if (i_state == InterruptState::PENDING) {
-                PANIC_STREAM->write_formatted(
-                    "Failed to handle exception {}: {}, Error code: {:0=#4x}\n",
-                    x64_i_ctx->i_vector,
-                    exception_name,
-                    x64_i_ctx->i_error_code);
-                while (true) __asm__("hlt");
-            }
         } else {
             // Handle IRQ
             U8 irq_line = vector - PIC->get_irq_line_offset();
@@ -216,6 +212,9 @@ namespace Rune::CPU {
     void interrupt_load_vector_table() {
         idt_load();
         init_interrupt_service_routines();
+        // A page fault caused by a kernel stack overflow cannot push its interrupt frame, the
+        // resulting double fault must therefore switch to a known good stack
+        idt_get()->entry[DOUBLE_FAULT_VECTOR].ist.ist = DOUBLE_FAULT_IST;
         // Enable CPU exceptions
         for (U8 i = 0; i < EXCEPTION_COUNT; i++) idt_get()->entry[i].flags.p = true;
     }
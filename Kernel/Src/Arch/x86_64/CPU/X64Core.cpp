@@ -41,6 +41,10 @@ namespace Rune::CPU {
     Array<SegmentDescriptor, 7> SD;
     GlobalDescriptorTable       GDT;
     TaskStateSegment64          TSS;
+
+    // Stack of the double fault handler, see DOUBLE_FAULT_IST
+    constexpr size_t                               DOUBLE_FAULT_STACK_SIZE = 16 * MemoryUnit::KiB;
+    alignas(16) Array<U8, DOUBLE_FAULT_STACK_SIZE> DOUBLE_FAULT_STACK;
     // NOLINTEND
 
     X64Core::X64Core(U8 core_id) : _core_id(core_id) {}
@@ -62,6 +66,8 @@ namespace Rune::CPU {
 
         enable_sse(); // Enable floating point instructions
         init_gdt(&GDT, &TSS);
+        static_assert(DOUBLE_FAULT_IST == 1, "The double fault stack is not in IST 1");
+        TSS.ist_0 = memory_pointer_to_addr(DOUBLE_FAULT_STACK.data()) + DOUBLE_FAULT_STACK_SIZE;
         load_gdtr(&GDT, GDTOffset::KERNEL_CODE, GDTOffset::KERNEL_DATA);
         load_task_state_register(GDTOffset::TSS);
 
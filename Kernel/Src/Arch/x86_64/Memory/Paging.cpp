@@ -47,6 +47,7 @@ namespace Rune::Memory {
     constexpr U8 IS_USER_MODE_ACCESS_BIT = 2;
     constexpr U8 IS_ACCESSED_BIT         = 5;
     constexpr U8 IS_DIRTY_BIT            = 6;
+    constexpr U8 IS_COPY_ON_WRITE_BIT    = 9; // Available to software, ignored by the MMU
 
 #define X86_64_PAGEFLAGS(X)                                                                        \
     X(x86_64PageFlag, PRESENT, 0x01)                                                               \
@@ -55,7 +56,8 @@ namespace Rune::Memory {
     X(x86_64PageFlag, WRITE_THROUGH, 0x08)                                                         \
     X(x86_64PageFlag, CACHE_DISABLE, 0x10)                                                         \
     X(x86_64PageFlag, ACCESSED, 0x20)                                                              \
-    X(x86_64PageFlag, DIRTY, 0x40)
+    X(x86_64PageFlag, DIRTY, 0x40)                                                                 \
+    X(x86_64PageFlag, COPY_ON_WRITE, 0x200)
 
     DECLARE_TYPED_ENUM(x86_64PageFlag, U16, X86_64_PAGEFLAGS, 0x0) // NOLINT
     DEFINE_TYPED_ENUM(x86_64PageFlag, U16, X86_64_PAGEFLAGS, 0x0)
@@ -117,6 +119,10 @@ namespace Rune::Memory {
 
     auto PageTableEntry::is_dirty() const -> bool { return bit_check(native_entry, IS_DIRTY_BIT); }
 
+    auto PageTableEntry::is_copy_on_write() const -> bool {
+        return bit_check(native_entry, IS_COPY_ON_WRITE_BIT);
+    }
+
     auto PageTableEntry::is_pointing_to_page_frame() const -> bool {
         // We only support 4KiB pages, so only page table entries (Level 1) can point to page frames
         // -> We can simply check by the PTE level, if it points to a page frame or another page
@@ -395,6 +401,23 @@ namespace Rune::Memory {
         return pta;
     }
 
+    auto remap_page(const PageTable& base_pt,
+                    VirtualAddr      v_addr,
+                    PhysicalAddr     page_frame,
+                    U16              flags) -> PageTableAccess {
+        PageTableAccess pta = access_page_hierarchy(base_pt, v_addr);
+        if (pta.status != PageTableAccessStatus::OKAY) return pta;
+        PageTable pt(pta.path[1].get_address(),
+                     reinterpret_cast<NativePageTableEntry*>(
+                         physical_to_virtual_address(pta.path[1].get_address())),
+                     1);
+        U16       pt_idx = (v_addr >> PHYSICAL_PAGE_OFFSET) & PT_IDX_MASK;
+        pt.update(pt_idx, page_frame | to_x86_64_flags(flags));
+        pta.pte_after        = pt[pt_idx];
+        pta.physical_address = page_frame + (v_addr & PAGE_FRAME_OFFSET_MASK);
+        return pta;
+    }
+
     auto find_page(const PageTable& base_pt, VirtualAddr v_addr) -> PageTableAccess {
         return access_page_hierarchy(base_pt, v_addr);
     }
@@ -16,10 +16,16 @@
 
 #include <SystemCall/SystemCall.h>
 
+#include <Ember/SystemCallID.h>
+
 #include <KRE/BitsAndBytes.h>
-#include <KRE/Collections/HashMap.h>
+#include <KRE/Build.h>
+#include <KRE/Math.h>
 #include <KRE/Utility.h>
 
+#include <CPU/Threading/CriticalSection.h>
+#include <CPU/Threading/Scheduler.h>
+
 #include "../CPU/X64Core.h"
 
 namespace Rune::SystemCall {
@@ -29,10 +35,137 @@ namespace Rune::SystemCall {
         SystemCallInfo info             = {.handle = 0, .name = "", .requested = 0};
         Handler        sys_call_handler = SYS_CALL_HANDLER_NONE;
         void*          context          = nullptr;
+        bool           installed        = false;
+    };
+
+    /// @brief Number of system call IDs per bundle, e.g. the VFS bundle has the IDs 300-399.
+    constexpr U16 BUNDLE_ID_RANGE = 100;
+
+    /**
+     * @brief Calculate the number of dispatch table slots a system call bundle needs.
+     * @param bundle_idx Index of the bundle.
+     * @param IDs        All system call IDs of the bundle.
+     * @return Highest call index of the bundle + 1 or 0 if an ID belongs to another bundle.
+     */
+    constexpr auto bundle_width(U16 bundle_idx, std::initializer_list<Ember::ResourceID> IDs)
+        -> U16 {
+        U16 width = 0;
+        for (Ember::ResourceID id : IDs) {
+            if (id / BUNDLE_ID_RANGE != bundle_idx) return 0;
+            if (id % BUNDLE_ID_RANGE >= width) width = id % BUNDLE_ID_RANGE + 1;
+        }
+        return width;
+    }
+
+    // The dispatch table is generated from the system call ID definitions, so a system call ID
+    // that does not fit its bundle is a compile error instead of a lost system call
+#define SYSTEM_CALL_ID(Class, Name, Value) Value,
+    constexpr U16 BUNDLE_WIDTH[] = {
+        0, // Bundle 0 is not used, the first system call ID is 100
+        bundle_width(1, {MEMORY_SYSCALLS(SYSTEM_CALL_ID)}),
+        bundle_width(2, {THREADING_SYSCALLS(SYSTEM_CALL_ID)}),
+        bundle_width(3, {VFS_SYSCALLS(SYSTEM_CALL_ID)}),
+        bundle_width(4, {APP_SYSCALLS(SYSTEM_CALL_ID)}),
+    };
+#undef SYSTEM_CALL_ID
+    constexpr U16 BUNDLE_COUNT = sizeof(BUNDLE_WIDTH) / sizeof(BUNDLE_WIDTH[0]);
+
+    static_assert(BUNDLE_WIDTH[1] > 0, "Memory system call IDs must be in [100, 200).");
+    static_assert(BUNDLE_WIDTH[2] > 0, "Threading system call IDs must be in [200, 300).");
+    static_assert(BUNDLE_WIDTH[3] > 0, "VFS system call IDs must be in [300, 400).");
+    static_assert(BUNDLE_WIDTH[4] > 0, "App system call IDs must be in [400, 500).");
+
+    // SYSTEM_CALL_TABLE[ID / BUNDLE_ID_RANGE][ID % BUNDLE_ID_RANGE] is the system call with the ID
+    SystemCallContainer* SYSTEM_CALL_TABLE[BUNDLE_COUNT]; // NOLINT
+    KernelGuardian*      K_GUARD;                         // NOLINT
+
+    /// @brief Marks a trace record that is being written.
+    constexpr U64 TRACE_RECORD_BUSY = static_cast<U64>(-1);
+    /// @brief Cores with a higher ID are not traced.
+    constexpr U8 TRACE_CORE_LIMIT = 16;
+
+    /**
+     * @brief The system call trace of a CPU core.
+     *
+     * A writer reserves a record by incrementing the head and publishes it by storing the sequence
+     * number in the record, readers copy a record and check afterward that the sequence number did
+     * not change. So neither side takes a lock, even when a traced system call is preempted by
+     * another one on the same core.
+     */
+    struct TraceRing {
+        U64                          head = 0;
+        Ember::SystemCallTraceRecord records[SYSTEM_CALL_TRACE_RING_SIZE]; // NOLINT
     };
 
-    HashMap<Ember::ResourceID, SystemCallContainer> SYSTEM_CALL_HANDLER_TABLE; // NOLINT
-    KernelGuardian*                                 K_GUARD;                   // NOLINT
+    U16        TRACED_APPS[SYSTEM_CALL_TRACED_APP_LIMIT]; // NOLINT Zero marks a free slot
+    U8         TRACED_APP_COUNT;                          // NOLINT
+    TraceRing* TRACE_RINGS[TRACE_CORE_LIMIT];             // NOLINT Allocated on the first trace
+
+    // Serializes enabling and disabling traces
+    CPU::InterruptSaveLock TRACE_LOCK; // NOLINT
+
+    /**
+     * @brief Get the dispatch table slot of a system call.
+     * @param ID
+     * @return The slot or a nullptr if the ID is outside the dispatch table.
+     */
+    auto find_system_call(Ember::ResourceID ID) -> SystemCallContainer* {
+        U16 bundle_idx = ID / BUNDLE_ID_RANGE;
+        U16 call_idx   = ID % BUNDLE_ID_RANGE;
+        if (bundle_idx >= BUNDLE_COUNT || call_idx >= BUNDLE_WIDTH[bundle_idx]) return nullptr;
+        return &SYSTEM_CALL_TABLE[bundle_idx][call_idx];
+    }
+
+    auto is_traced(U16 app_handle) -> bool {
+        for (U16 traced_app : TRACED_APPS)
+            if (traced_app == app_handle) return true;
+        return false;
+    }
+
+    auto latency_bucket(U64 cycles) -> U8 {
+        if (cycles == 0) return 0;
+        const U8 bucket = 63 - __builtin_clzll(cycles); // floor(log2(cycles))
+        return min(bucket, static_cast<U8>(Ember::SYSTEM_CALL_LATENCY_BUCKETS - 1));
+    }
+
+    /**
+     * @brief Update the latency statistics of the system call and append the record to the trace
+     * ring of the current core.
+     * @param sys_call
+     * @param record   The record, the sequence number is assigned here.
+     */
+    void record_system_call(SystemCallContainer* sys_call, Ember::SystemCallTraceRecord& record) {
+        Ember::SystemCallStats& stats = sys_call->info.latency;
+        __atomic_fetch_add(&stats.count, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&stats.total_cycles, record.cycles, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&stats.latency_histogram[latency_bucket(record.cycles)],
+                           1,
+                           __ATOMIC_RELAXED);
+        U64 max_cycles = __atomic_load_n(&stats.max_cycles, __ATOMIC_RELAXED);
+        while (record.cycles > max_cycles
+               && !__atomic_compare_exchange_n(&stats.max_cycles,
+                                               &max_cycles,
+                                               record.cycles,
+                                               false,
+                                               __ATOMIC_RELAXED,
+                                               __ATOMIC_RELAXED)) {
+            // max_cycles was updated to the current maximum -> Try again
+        }
+
+        const U8 core_id = CPU::current_core()->get_id();
+        if (core_id >= TRACE_CORE_LIMIT) return;
+        TraceRing* ring = TRACE_RINGS[core_id];
+        if (ring == nullptr) return;
+
+        const U64 seq   = __atomic_fetch_add(&ring->head, 1, __ATOMIC_RELAXED);
+        auto&     slot  = ring->records[seq % SYSTEM_CALL_TRACE_RING_SIZE];
+        record.sequence = seq;
+        __atomic_store_n(&slot.sequence, TRACE_RECORD_BUSY, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        slot = record;
+        // Publish the record after it is completely written
+        __atomic_store_n(&slot.sequence, seq, __ATOMIC_RELEASE);
+    }
 
     /**
      * @brief On "syscall" the CPU will jump to this assembly stub. It loads the kernel stack and
@@ -48,24 +181,57 @@ namespace Rune::SystemCall {
                                     Ember::SystemCallArgument arg4,
                                     Ember::SystemCallArgument arg5,
                                     Ember::SystemCallArgument arg6) -> Ember::StatusCode {
-        Ember::StatusCode ret     = -1;
-        auto              handler = SYSTEM_CALL_HANDLER_TABLE.find(ID);
-        if (handler != SYSTEM_CALL_HANDLER_TABLE.end()) {
-            LOGGER->trace(R"(Handling system call request: "{}-{}"!)",
-                          ID,
-                          handler->value->info.name);
-            handler->value->info.requested++;
-            ret = handler->value->sys_call_handler(forward<void*>(handler->value->context),
-                                                   arg1,
-                                                   arg2,
-                                                   arg3,
-                                                   arg4,
-                                                   arg5,
-                                                   arg6);
-        } else {
+        SystemCallContainer* sys_call = find_system_call(ID);
+        if (sys_call == nullptr || !sys_call->installed) {
             LOGGER->warn("No system call with ID {} installed!", ID);
+            return -1;
+        }
+#ifdef SYSTEM_CALL_TRACE
+        LOGGER->trace(R"(Handling system call request: "{}-{}"!)", ID, sys_call->info.name);
+#endif
+        sys_call->info.requested++;
+        // The time spent in the system call is kernel time of the calling thread, the raw pointer
+        // is used because system calls like thread exit never return
+        auto* running_thread = CPU::g_scheduler.get_running_thread().get();
+        running_thread->account_cycles(CPU::read_timestamp_counter());
+        running_thread->in_system_call = true;
+        running_thread->system_call_count++;
+
+        Ember::StatusCode status = 0;
+        // Untraced system calls only pay for the check of the traced app count
+        if (__atomic_load_n(&TRACED_APP_COUNT, __ATOMIC_RELAXED) == 0
+            || !is_traced(running_thread->app_handle)) {
+            status = sys_call->sys_call_handler(forward<void*>(sys_call->context),
+                                                arg1,
+                                                arg2,
+                                                arg3,
+                                                arg4,
+                                                arg5,
+                                                arg6);
+        } else {
+            Ember::SystemCallTraceRecord record{
+                .args          = {arg1, arg2, arg3, arg4, arg5, arg6},
+                .ID            = ID,
+                .app_handle    = running_thread->app_handle,
+                .thread_handle = running_thread->get_handle()};
+            record.start  = CPU::read_timestamp_counter();
+            record.status = sys_call->sys_call_handler(forward<void*>(sys_call->context),
+                                                       arg1,
+                                                       arg2,
+                                                       arg3,
+                                                       arg4,
+                                                       arg5,
+                                                       arg6);
+            record.cycles = CPU::read_timestamp_counter() - record.start;
+            record_system_call(sys_call, record);
+            status = record.status;
         }
-        return ret;
+
+        running_thread->account_cycles(CPU::read_timestamp_counter());
+        running_thread->in_system_call           = false;
+        running_thread->pinned_user_memory_start = 0x0;
+        running_thread->pinned_user_memory_end   = 0x0;
+        return status;
     }
 
     //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -73,8 +239,12 @@ namespace Rune::SystemCall {
     //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 
     auto system_call_init(KernelGuardian* k_guard) -> bool {
-        K_GUARD                   = k_guard;
-        SYSTEM_CALL_HANDLER_TABLE = HashMap<U16, SystemCallContainer>();
+        K_GUARD = k_guard;
+        for (U16 i = 0; i < BUNDLE_COUNT; i++) {
+            delete[] SYSTEM_CALL_TABLE[i];
+            SYSTEM_CALL_TABLE[i] = BUNDLE_WIDTH[i] > 0 ? new SystemCallContainer[BUNDLE_WIDTH[i]]
+                                                       : nullptr;
+        }
         // Init the model specific registers for sysret/syscall, they act as caches for important
         // values CS/SS selectors
         // syscall: CS = STAR[47:32], SS = STAR[63:48] + 8, RPL bits 48:49 are 00 as syscall goes
@@ -105,39 +275,118 @@ namespace Rune::SystemCall {
 
     auto system_call_get_table() -> LinkedList<SystemCallInfo> {
         LinkedList<SystemCallInfo> sys_call_table;
-        for (const auto& sys_con : SYSTEM_CALL_HANDLER_TABLE)
-            sys_call_table.add_back(sys_con.value->info); // NOLINT only end() can be null
+        for (U16 i = 0; i < BUNDLE_COUNT; i++) {
+            for (U16 j = 0; j < BUNDLE_WIDTH[i]; j++) {
+                if (SYSTEM_CALL_TABLE[i][j].installed)
+                    sys_call_table.add_back(SYSTEM_CALL_TABLE[i][j].info);
+            }
+        }
         return sys_call_table;
     }
 
     auto system_call_install(const Definition& sys_call_def) -> bool {
-        if (SYSTEM_CALL_HANDLER_TABLE.find(sys_call_def.ID) != SYSTEM_CALL_HANDLER_TABLE.end()) {
+        SystemCallContainer* sys_call = find_system_call(sys_call_def.ID);
+        if (sys_call == nullptr) {
+            LOGGER->warn(R"(Cannot install system call "{}-{}". Unknown system call ID...)",
+                         sys_call_def.ID,
+                         sys_call_def.name);
+            return false;
+        }
+        if (sys_call->installed) {
             LOGGER->warn("Cannot install system call {}. It is already installed...",
                          sys_call_def.ID);
             return false;
         }
         LOGGER->trace(R"(Installing system call "{}-{}".)", sys_call_def.ID, sys_call_def.name);
-        SYSTEM_CALL_HANDLER_TABLE.put(
-            sys_call_def.ID,
-            {
-            .info = {.handle = sys_call_def.ID, .name = sys_call_def.name, .requested = 0},
+        *sys_call = {
+            .info = {.handle    = sys_call_def.ID,
+                     .name      = sys_call_def.name,
+                     .requested = 0,
+                     .latency   = {.ID = sys_call_def.ID}},
             .sys_call_handler = sys_call_def.sys_call_handler,
-            .context          = sys_call_def.context
-        });
+            .context          = sys_call_def.context,
+            .installed        = true
+        };
         return true;
     }
 
     auto system_call_uninstall(U16 system_call_id) -> bool {
-        if (SYSTEM_CALL_HANDLER_TABLE.find(system_call_id) == SYSTEM_CALL_HANDLER_TABLE.end()) {
+        SystemCallContainer* sys_call = find_system_call(system_call_id);
+        if (sys_call == nullptr || !sys_call->installed) {
             LOGGER->trace("System call {} is not installed. No need to uninstall...",
                           system_call_id);
             return false;
         }
 
-        auto sys_call = SYSTEM_CALL_HANDLER_TABLE.find(system_call_id);
         LOGGER->trace(R"(Uninstalling system call "{}-{}".)",
-                      sys_call->value->info.handle,
-                      sys_call->value->info.name);
-        return SYSTEM_CALL_HANDLER_TABLE.remove(system_call_id);
+                      sys_call->info.handle,
+                      sys_call->info.name);
+        *sys_call = SystemCallContainer();
+        return true;
+    }
+
+    auto system_call_trace(U16 app_handle, bool enable) -> bool {
+        if (app_handle == 0) return false;
+        // Traced system calls only read the slots, concurrent enables and disables are serialized
+        // so they neither claim the same slot nor allocate a trace ring twice
+        CPU::CriticalSection<CPU::InterruptSaveLock> _(TRACE_LOCK);
+        if (!enable) {
+            for (U16& traced_app : TRACED_APPS) {
+                if (traced_app != app_handle) continue;
+                __atomic_store_n(&traced_app, 0, __ATOMIC_RELAXED);
+                __atomic_fetch_sub(&TRACED_APP_COUNT, 1, __ATOMIC_RELAXED);
+            }
+            return true;
+        }
+        if (is_traced(app_handle)) return true;
+
+        for (CPU::Core* core : CPU::get_core_table()) {
+            const U8 core_id = core->get_id();
+            if (core_id >= TRACE_CORE_LIMIT || TRACE_RINGS[core_id] != nullptr) continue;
+            TRACE_RINGS[core_id] = new TraceRing();
+            if (TRACE_RINGS[core_id] == nullptr) {
+                LOGGER->warn("Failed to allocate the system call trace ring of core {}.", core_id);
+                return false;
+            }
+        }
+
+        for (U16& traced_app : TRACED_APPS) {
+            if (traced_app != 0) continue;
+            // Count the app first, so it is not missed by a concurrent system call
+            __atomic_fetch_add(&TRACED_APP_COUNT, 1, __ATOMIC_RELAXED);
+            __atomic_store_n(&traced_app, app_handle, __ATOMIC_RELAXED);
+            LOGGER->debug("Tracing the system calls of app {}.", app_handle);
+            return true;
+        }
+        return false;
+    }
+
+    auto system_call_trace_read(U8                            core_id,
+                                U64&                          cursor,
+                                Ember::SystemCallTraceRecord* buf,
+                                size_t                        buf_size) -> int {
+        if (core_id >= TRACE_CORE_LIMIT || TRACE_RINGS[core_id] == nullptr) return -1;
+
+        TraceRing* ring = TRACE_RINGS[core_id];
+        const U64  head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+        // Older records are overwritten
+        if (head > SYSTEM_CALL_TRACE_RING_SIZE && cursor < head - SYSTEM_CALL_TRACE_RING_SIZE)
+            cursor = head - SYSTEM_CALL_TRACE_RING_SIZE;
+
+        int count = 0;
+        while (cursor < head && static_cast<size_t>(count) < buf_size) {
+            const auto& slot = ring->records[cursor % SYSTEM_CALL_TRACE_RING_SIZE];
+            const U64   seq  = __atomic_load_n(&slot.sequence, __ATOMIC_ACQUIRE);
+            // The record is still being written -> Stop here and read it next time
+            if (seq == TRACE_RECORD_BUSY || seq < cursor) break;
+
+            buf[count] = slot;
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            if (seq == cursor && __atomic_load_n(&slot.sequence, __ATOMIC_RELAXED) == seq)
+                count++;
+            // Else the record was overwritten by a newer one, it is lost
+            cursor++;
+        }
+        return count;
     }
 } // namespace Rune::SystemCall
@@ -231,6 +231,8 @@ namespace Rune {
     auto System::get_boot_info() -> BootInfo& { return _boot_info; }
 
     void System::shutdown() { // NOLINT
+        if (!get_module<VFS::VFSModule>(ModuleSelector::VFS)->sync())
+            LOGGER->warn("Failed to sync all storage devices before power off.");
         auto*               dm    = get_module<Device::DeviceModule>(ModuleSelector::DEVICE);
         Device::ACPIRequest a_req = Device::ACPIRequest::SHUTDOWN;
         Device::IORequest   req{.m_in_buffer = &a_req, .m_out_buffer = nullptr};
@@ -240,6 +242,8 @@ namespace Rune {
     }
 
     void System::reboot() {
+        if (!get_module<VFS::VFSModule>(ModuleSelector::VFS)->sync())
+            LOGGER->warn("Failed to sync all storage devices before reboot.");
         LOGGER->info("Performing reboot. Try ACPI reset...");
         auto*               dm    = get_module<Device::DeviceModule>(ModuleSelector::DEVICE);
         Device::ACPIRequest a_req = Device::ACPIRequest::REBOOT;
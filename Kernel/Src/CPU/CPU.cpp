@@ -27,6 +27,14 @@ namespace Rune::CPU {
 
     Thread::Thread(MutexHandle handle, const String& name) : Resource(handle, name) {}
 
+    void Thread::account_cycles(const U64 now) {
+        if (in_system_call || user_stack.stack_top == 0x0)
+            kernel_cycles += now - accounting_mark;
+        else
+            user_cycles += now - accounting_mark;
+        accounting_mark = now;
+    }
+
     auto operator==(const Thread& one, const Thread& two) -> bool {
         return one.get_handle() == two.get_handle();
     }
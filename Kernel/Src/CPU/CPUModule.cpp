@@ -16,9 +16,18 @@
 
 #include <CPU/CPUModule.h>
 
+#include <KRE/System/System.h>
+
+#include <Memory/MemoryModule.h>
 #include <Memory/Paging.h>
 
+#include <CPU/Interrupt/Exception.h>
+
 #include <CPU/Threading/CriticalSection.h>
+#include <CPU/Threading/Futex.h>
+#include <CPU/Threading/KernelStackAllocator.h>
+#include <CPU/Threading/WaitQueue.h>
+#include <CPU/Threading/WaitSet.h>
 
 namespace Rune::CPU {
     const SharedPointer<Logger> LOGGER = LogContext::instance().get_logger("CPU.CPUModule");
@@ -77,7 +86,7 @@ namespace Rune::CPU {
                 auto* next = g_scheduler.get_ready_queue()->peek();
                 if (next == nullptr) next = g_scheduler.get_idle_thread().get();
                 ON_THREAD_STOPPED(forward<Thread*>(dT.value().get()), forward<Thread*>(next));
-                delete[] dT.value()->kernel_stack_bottom;
+                g_kernel_stack_allocator.free(dT.value()->kernel_stack_bottom);
 
                 if (dT.value().get_ref_count() > 1) {
                     LOGGER->warn(
@@ -109,7 +118,9 @@ namespace Rune::CPU {
                        PhysicalAddr     base_pt_addr,
                        SchedulingPolicy policy,
                        Stack            user_stack) -> SharedPointer<Thread> {
-        SharedPointer<Thread> new_thread    = g_thread_cache.allocate(thread_name);
+        SharedPointer<Thread> new_thread = g_thread_cache.allocate(thread_name);
+        if (!new_thread) return new_thread; // The thread table is out of handles
+
         new_thread->start_info              = start_info;
         new_thread->base_page_table_address = base_pt_addr;
         new_thread->policy                  = policy;
@@ -124,16 +135,28 @@ namespace Rune::CPU {
     auto CPUModule::load(const BootInfo& boot_info) -> bool {
 
         // Init Event Hook table
-        _event_hook_table.put(EventHook(EventHook::THREAD_CREATED).to_string(),
-                              LinkedList<EventHandlerTableEntry>());
-        _event_hook_table.put(EventHook(EventHook::THREAD_STOPPED).to_string(),
-                              LinkedList<EventHandlerTableEntry>());
-        _event_hook_table.put(EventHook(EventHook::THREAD_PREEMPTED).to_string(),
-                              LinkedList<EventHandlerTableEntry>());
+        for (const EventHook evt_hook :
+             {EventHook::THREAD_CREATED, EventHook::THREAD_STOPPED, EventHook::THREAD_PREEMPTED})
+            add_event_hook(evt_hook, evt_hook.to_string());
 
         // Init Interrupts/IRQs
         LOGGER->debug("Loading interrupt vector table...");
         interrupt_load_vector_table();
+        auto* memory_module =
+            System::instance().get_module<Memory::MemoryModule>(ModuleSelector::MEMORY);
+        auto* vmm = memory_module->get_virtual_memory_manager();
+        // Writes to copy-on-write pages of apps are resolved by giving the app its own copy of the
+        // page, every other page fault is fatal
+        exception_install_handler(
+            ExceptionType::PAGE_FAULT,
+            [vmm](InterruptFrame* i_frame) -> InterruptState {
+                SILENCE_UNUSED(i_frame)
+                const VirtualAddr fault_addr = get_page_fault_address();
+                if (fault_addr >= vmm->get_user_space_end()) return InterruptState::PENDING;
+                return vmm->resolve_copy_on_write(Memory::get_base_page_table(), fault_addr)
+                           ? InterruptState::HANDLED
+                           : InterruptState::PENDING;
+            });
         if (_pic_driver_table.empty()) {
             LOGGER->critical("No PIC drivers are installed...");
             return false;
@@ -148,6 +171,16 @@ namespace Rune::CPU {
         LOGGER->debug(R"("{}" has been initialized.)", _active_pic->get_name());
 
         // Init Scheduling
+        LOGGER->debug("Starting the kernel stack allocator...");
+        MemoryRegion kernel_stacks;
+        for (const auto& reg : memory_module->get_virtual_memory_map()) {
+            if (reg.memory_type == MemoryRegionType::KERNEL_STACKS) kernel_stacks = reg;
+        }
+        if (!g_kernel_stack_allocator.init(vmm, kernel_stacks)) {
+            LOGGER->critical("No kernel stack region is available...");
+            return false;
+        }
+
         LOGGER->debug("Starting the Scheduler...");
         PhysicalAddr base_pt_addr = Memory::get_base_page_table_address();
         // Set the code running since the start of the machine as the initial thread
@@ -201,8 +234,7 @@ namespace Rune::CPU {
                 _on_stop_syncing_threads.remove(term->get_handle());
             }
 
-            fire(EventHook(EventHook::THREAD_STOPPED).to_string(),
-                 reinterpret_cast<void*>(&tt_ctx));
+            fire(EventHook::THREAD_STOPPED, reinterpret_cast<void*>(&tt_ctx));
 
             if (g_thread_cache.free(term->get_handle())) {
                 LOGGER->trace(R"(Removed {} from the thread cache)", term->get_unique_name());
@@ -211,7 +243,7 @@ namespace Rune::CPU {
             }
         };
         g_scheduler.set_on_context_switch([this](Thread* next) -> void {
-            fire(EventHook(EventHook::THREAD_PREEMPTED).to_string(), reinterpret_cast<void*>(next));
+            fire(EventHook::THREAD_PREEMPTED, reinterpret_cast<void*>(next));
         });
 
         // Init Timer
@@ -293,7 +325,8 @@ namespace Rune::CPU {
                                         Stack            user_stack) -> ThreadHandle {
         SharedPointer<Thread> new_thread =
             create_thread(thread_name, move(start_info), base_pt_addr, policy, move(user_stack));
-        fire(EventHook(EventHook::THREAD_CREATED).to_string(), new_thread.get());
+        if (!new_thread) return Resource<ThreadHandle>::HANDLE_NONE;
+        fire(EventHook::THREAD_CREATED, new_thread.get());
         if (!g_scheduler.schedule(new_thread)) {
             g_thread_cache.free(new_thread->get_handle());
             return Resource<ThreadHandle>::HANDLE_NONE;
@@ -391,6 +424,14 @@ namespace Rune::CPU {
                     LOGGER->trace(R"({} is already stopped.)", thread_to_stop->get_unique_name());
                     return true;
             }
+
+            // A waiting thread may also be ready or have a timer, e.g. it was woken by the timeout
+            // but has not removed itself yet -> Always drop it from the wait queues
+            g_futex_table.remove_waiters(thread_to_stop);
+            if (thread_to_stop->wait_queue != nullptr)
+                thread_to_stop->wait_queue->remove_waiter(thread_to_stop);
+            if (thread_to_stop->wait_set != nullptr)
+                thread_to_stop->wait_set->remove_waiter(thread_to_stop);
         }
 
         g_scheduler.stop(thread_to_stop);
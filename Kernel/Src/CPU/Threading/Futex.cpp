@@ -0,0 +1,112 @@
+/*
+ *  Copyright 2025 Ewogijk
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+#include <CPU/Threading/Futex.h>
+
+#include <CPU/Threading/Atomic.h>
+#include <CPU/Threading/CriticalSection.h>
+
+namespace Rune::CPU {
+    DEFINE_ENUM(FutexWaitStatus, FUTEX_WAIT_STATUSES, 0x0)
+
+    FutexTable g_futex_table;
+
+    auto FutexTable::get_bucket(PhysicalAddr address_space, VirtualAddr address) -> Bucket& {
+        // Futexes are at least 4 byte aligned and page tables are page aligned -> Drop the zero
+        // bits before mixing
+        U64 hash = (address >> 2) ^ (address_space >> 12);
+        hash     = (hash ^ (hash >> 16)) * 0x45D9F3B;
+        return _buckets[(hash ^ (hash >> 16)) % BUCKET_COUNT];
+    }
+
+    auto FutexTable::wait(volatile int* futex, int expected, Timer* timer, U64 timeout_nanos)
+        -> FutexWaitStatus {
+        auto running_thread     = g_scheduler.get_running_thread();
+        auto waiter             = SharedPointer<Waiter>(new Waiter());
+        waiter->address_space   = running_thread->base_page_table_address;
+        waiter->address         = memory_pointer_to_addr(futex);
+        waiter->thread          = running_thread;
+        Bucket& bucket          = get_bucket(waiter->address_space, waiter->address);
+        {
+            CriticalSection<InterruptSaveLock> _(bucket.lock);
+            // A waker changes the value before it wakes the futex -> If the value is still the
+            // expected one, the wake up cannot have happened yet
+            if (atomic_load_acquire(futex) != expected) return FutexWaitStatus::VALUE_CHANGED;
+
+            // Interrupts are disabled, so the timer cannot wake the thread before it is marked
+            if (timeout_nanos != Ember::WAIT_FOREVER) {
+                U64 now       = timer->get_time_since_start();
+                U64 wake_time = timeout_nanos < Ember::WAIT_FOREVER - now
+                                    ? now + timeout_nanos
+                                    : Ember::WAIT_FOREVER;
+                if (!timer->schedule_wake_up(wake_time)) return FutexWaitStatus::TIMED_OUT;
+            }
+            g_scheduler.mark_as_block_pending();
+            bucket.waiters.add_back(waiter);
+        }
+        g_scheduler.block();
+
+        CriticalSection<InterruptSaveLock> _(bucket.lock);
+        // Woken by the timer -> Still in the bucket
+        if (!waiter->is_woken) bucket.waiters.remove(waiter);
+        if (running_thread->timer_handle != Resource<TimerHandle>::HANDLE_NONE) {
+            timer->remove_sleeping_thread(running_thread->get_handle());
+            running_thread->timer_handle = Resource<TimerHandle>::HANDLE_NONE;
+        }
+        return waiter->is_woken ? FutexWaitStatus::WOKEN : FutexWaitStatus::TIMED_OUT;
+    }
+
+    auto FutexTable::wake(PhysicalAddr address_space, VirtualAddr address, size_t count)
+        -> size_t {
+        Bucket&                            bucket = get_bucket(address_space, address);
+        CriticalSection<InterruptSaveLock> _(bucket.lock);
+        LinkedList<SharedPointer<Waiter>>  remaining;
+        size_t                             woken = 0;
+        while (!bucket.waiters.empty()) {
+            auto waiter = bucket.waiters.remove_front().value();
+            if (woken == count || waiter->address_space != address_space
+                || waiter->address != address) {
+                remaining.add_back(waiter);
+                continue;
+            }
+
+            // The thread could have been woken by the timer in the meantime -> It removes its
+            // waiter itself and must not consume the wake up
+            if (waiter->thread->state != ThreadState::BLOCKED
+                && waiter->thread->state != ThreadState::BLOCK_PENDING) {
+                remaining.add_back(waiter);
+                continue;
+            }
+            waiter->is_woken = true;
+            woken++;
+            g_scheduler.unblock(waiter->thread);
+        }
+        bucket.waiters = move(remaining);
+        return woken;
+    }
+
+    void FutexTable::remove_waiters(const SharedPointer<Thread>& thread) {
+        for (size_t i = 0; i < BUCKET_COUNT; i++) {
+            Bucket&                            bucket = _buckets[i];
+            CriticalSection<InterruptSaveLock> _(bucket.lock);
+            LinkedList<SharedPointer<Waiter>>  remaining;
+            while (!bucket.waiters.empty()) {
+                auto waiter = bucket.waiters.remove_front().value();
+                if (waiter->thread != thread) remaining.add_back(waiter);
+            }
+            bucket.waiters = move(remaining);
+        }
+    }
+} // namespace Rune::CPU
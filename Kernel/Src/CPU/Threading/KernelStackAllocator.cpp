@@ -0,0 +1,98 @@
+/*
+ *  Copyright 2025 Ewogijk
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <CPU/Threading/KernelStackAllocator.h>
+
+#include <CPU/CPU.h>
+#include <CPU/Threading/CriticalSection.h>
+
+namespace Rune::CPU {
+    KernelStackAllocator g_kernel_stack_allocator;
+
+    auto KernelStackAllocator::get_cpu_cache() -> FreeStackCache* {
+        const U8 core_id = current_core()->get_id();
+        return core_id < CPU_CACHE_LIMIT ? &_cpu_caches[core_id] : nullptr;
+    }
+
+    KernelStackAllocator::KernelStackAllocator()
+        : _vmm(nullptr),
+          _region_start(0),
+          _slot_size(0),
+          _free_slots(nullptr),
+          _free_slot_count(0) {}
+
+    KernelStackAllocator::~KernelStackAllocator() { delete[] _free_slots; }
+
+    auto KernelStackAllocator::init(Memory::VirtualMemoryManager* vmm, const MemoryRegion& region)
+        -> bool {
+        _vmm                    = vmm;
+        _region_start           = region.start;
+        _slot_size              = Memory::get_page_size() + Thread::KERNEL_STACK_SIZE;
+        const size_t slot_count = region.size / _slot_size;
+        if (slot_count == 0) return false;
+
+        // Hand out the slots from the start of the region first
+        _free_slots      = new U32[slot_count];
+        _free_slot_count = slot_count;
+        for (size_t i = 0; i < slot_count; i++) _free_slots[i] = slot_count - 1 - i;
+        return true;
+    }
+
+    auto KernelStackAllocator::allocate() -> U8* {
+        FreeStackCache* cache = get_cpu_cache();
+        if (cache != nullptr) {
+            CriticalSection<InterruptSaveLock> _(cache->lock);
+            if (cache->count > 0) return cache->stacks[--cache->count];
+        }
+
+        U32 slot = 0;
+        {
+            CriticalSection<InterruptSaveLock> _(_slot_lock);
+            if (_free_slot_count == 0) return nullptr;
+            slot = _free_slots[--_free_slot_count];
+        }
+
+        // The first page of the slot is the guard page
+        const VirtualAddr stack_bottom =
+            _region_start + (slot * _slot_size) + Memory::get_page_size();
+        if (!_vmm->allocate(stack_bottom,
+                            Memory::PageFlag::PRESENT | Memory::PageFlag::WRITE_ALLOWED,
+                            Thread::KERNEL_STACK_SIZE / Memory::get_page_size())) {
+            CriticalSection<InterruptSaveLock> _(_slot_lock);
+            _free_slots[_free_slot_count++] = slot;
+            return nullptr;
+        }
+        return memory_addr_to_pointer<U8>(stack_bottom);
+    }
+
+    void KernelStackAllocator::free(U8* stack_bottom) {
+        if (stack_bottom == nullptr) return;
+
+        FreeStackCache* cache = get_cpu_cache();
+        if (cache != nullptr) {
+            CriticalSection<InterruptSaveLock> _(cache->lock);
+            if (cache->count < CPU_CACHE_SIZE) {
+                cache->stacks[cache->count++] = stack_bottom;
+                return;
+            }
+        }
+
+        const VirtualAddr v_addr = memory_pointer_to_addr(stack_bottom);
+        _vmm->free(v_addr, Thread::KERNEL_STACK_SIZE / Memory::get_page_size());
+        CriticalSection<InterruptSaveLock> _(_slot_lock);
+        _free_slots[_free_slot_count++] = (v_addr - _region_start) / _slot_size;
+    }
+} // namespace Rune::CPU
@@ -42,6 +42,8 @@ namespace Rune::CPU {
         return copy;
     }
 
+    auto Mutex::get_unlock_wait_queue() -> WaitQueue* { return &_unlock_wait_queue; }
+
     void Mutex::lock() {
         // Retry loop for mutex locking
         // Reasoning: After a thread is woken up it must try to lock again and not assume it can
@@ -100,6 +102,7 @@ namespace Rune::CPU {
         trace_state("unlock");
         // if (thread_to_wake) g_scheduler.unblock(thread_to_wake);
         g_scheduler.unblock(thread_to_wake);
+        if (!thread_to_wake) _unlock_wait_queue.wake_all();
     }
 
     auto Mutex::remove_thread(MutexHandle handle) -> bool {
@@ -20,6 +20,7 @@
 
 #include <CPU/CPU.h>
 #include <CPU/Interrupt/Interrupt.h>
+#include <CPU/Threading/KernelStackAllocator.h>
 #include <CPU/Threading/Stack.h>
 
 namespace Rune::CPU {
@@ -29,17 +30,19 @@ namespace Rune::CPU {
     //                                  Private Functions
     //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 
-    void Scheduler::setup_kernel_stack(const SharedPointer<CPU::Thread>& thread) {
+    auto Scheduler::setup_kernel_stack(const SharedPointer<CPU::Thread>& thread) -> bool {
         // Create kernel stack - only used for system calls and interrupts
         // Context switches will only ever happen between kernel stacks that's
         // why we have to set it up, so it jumps to the thread startup function
-        auto* stack_bottom = new U8[Thread::KERNEL_STACK_SIZE];
-        auto  stack_top    = setup_trampoline_kernel_stack(memory_pointer_to_addr(stack_bottom)
-                                                               + Thread::KERNEL_STACK_SIZE,
-                                                           memory_pointer_to_addr(_thread_enter));
+        auto* stack_bottom = g_kernel_stack_allocator.allocate();
+        if (stack_bottom == nullptr) return false;
+        auto stack_top = setup_trampoline_kernel_stack(memory_pointer_to_addr(stack_bottom)
+                                                           + Thread::KERNEL_STACK_SIZE,
+                                                       memory_pointer_to_addr(_thread_enter));
 
         thread->kernel_stack_top    = stack_top;
         thread->kernel_stack_bottom = stack_bottom;
+        return true;
     }
 
     auto Scheduler::next_scheduled_thread() -> SharedPointer<Thread> {
@@ -114,9 +117,16 @@ namespace Rune::CPU {
         }
 
         // Switch to next thread
-        LOGGER->trace(R"(Context switch: {} -> {})",
-                      _running_thread->get_unique_name(),
-                      next_thread->get_unique_name());
+        // The unique names are formatted even if the message is discarded
+        if (LOGGER->get_log_level() == LogLevel::TRACE)
+            LOGGER->trace(R"(Context switch: {} -> {})",
+                          _running_thread->get_unique_name(),
+                          next_thread->get_unique_name());
+
+        // The CPU time of the next thread is accounted from here on
+        const U64 now = read_timestamp_counter();
+        _running_thread->account_cycles(now);
+        next_thread->accounting_mark = now;
 
         auto* old_thread       = _running_thread.get();
         _running_thread        = move(next_thread);
@@ -173,11 +183,11 @@ namespace Rune::CPU {
         _thread_enter        = thread_enter;
         _running_thread      = bootstrap_thread;
 
-        setup_kernel_stack(thread_terminator);
+        if (!setup_kernel_stack(thread_terminator)) return false;
         _garbage_collector_thread        = thread_terminator;
         _garbage_collector_thread->state = ThreadState::BLOCKED;
 
-        setup_kernel_stack(idle_thread);
+        if (!setup_kernel_stack(idle_thread)) return false;
         _idle_thread        = idle_thread;
         _idle_thread->state = ThreadState::BLOCKED;
         return true;
@@ -202,11 +212,15 @@ namespace Rune::CPU {
             return false;
         }
 
-        setup_kernel_stack(thread);
+        if (!setup_kernel_stack(thread)) {
+            LOGGER->error(R"({}: No kernel stack available)", thread->get_unique_name());
+            unlock();
+            return false;
+        }
         if (!_ready_queue->enqueue(thread)) {
             LOGGER->error(R"({}-{}: Schedule failed... Freeing kernel stack)",
                           thread->get_unique_name());
-            delete[] thread->kernel_stack_bottom;
+            g_kernel_stack_allocator.free(thread->kernel_stack_bottom);
             unlock();
             return false;
         }
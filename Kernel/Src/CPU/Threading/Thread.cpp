@@ -14,7 +14,27 @@
 
 #include <CPU/Threading/Thread.h>
 
+#include <KRE/System/System.h>
+
+#include <Memory/MemoryModule.h>
+
 namespace Rune::CPU {
+    Memory::ObjectCache* THREAD_OBJECT_CACHE = nullptr; // NOLINT Created by the first thread
+
+    auto Thread::operator new(size_t size) noexcept -> void* {
+        SILENCE_UNUSED(size)
+        if (THREAD_OBJECT_CACHE == nullptr) {
+            auto* memory_module =
+                System::instance().get_module<Memory::MemoryModule>(ModuleSelector::MEMORY);
+            THREAD_OBJECT_CACHE =
+                memory_module->get_heap()->create_new_cache(sizeof(Thread), alignof(Thread), false);
+            if (THREAD_OBJECT_CACHE == nullptr) return nullptr;
+        }
+        return THREAD_OBJECT_CACHE->allocate();
+    }
+
+    void Thread::operator delete(void* thread) { THREAD_OBJECT_CACHE->free(thread); }
+
     ResourceCache<Thread, 4>
         g_thread_cache({"ID-Name", "State", "Policy", "App"},
                        [](const SharedPointer<Thread>& thread) -> Array<String, 4> {
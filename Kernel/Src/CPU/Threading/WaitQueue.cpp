@@ -0,0 +1,73 @@
+/*
+ *  Copyright 2025 Ewogijk
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+#include <CPU/Threading/WaitQueue.h>
+
+#include <CPU/Threading/CriticalSection.h>
+
+namespace Rune::CPU {
+    auto WaitQueue::get_waiting_threads() const -> LinkedList<Thread*> {
+        LinkedList<Thread*> copy;
+        for (auto& t : _waiters) copy.add_back(t.get());
+        return copy;
+    }
+
+    void WaitQueue::wait(const Function<bool()>& has_happened) {
+        {
+            CriticalSection<InterruptSaveLock> _(_lock);
+            if (has_happened()) return;
+            // Mark the thread before enqueuing it, otherwise a wake up between enqueuing and
+            // blocking would be lost
+            g_scheduler.mark_as_block_pending();
+            g_scheduler.get_running_thread()->wait_queue = this;
+            _waiters.add_back(g_scheduler.get_running_thread());
+        }
+        g_scheduler.block();
+    }
+
+    void WaitQueue::add_watcher(WaitQueueWatcher* watcher) {
+        CriticalSection<InterruptSaveLock> _(_lock);
+        _watchers.add_back(watcher);
+    }
+
+    void WaitQueue::remove_watcher(WaitQueueWatcher* watcher) {
+        CriticalSection<InterruptSaveLock> _(_lock);
+        _watchers.remove(watcher);
+    }
+
+    auto WaitQueue::wake_all() -> bool {
+        CriticalSection<InterruptSaveLock> _(_lock);
+        bool                               next_is_woken = false;
+        for (auto* watcher : _watchers)
+            if (watcher->notify()) next_is_woken = true;
+        while (!_waiters.empty()) {
+            auto thread        = _waiters.remove_front().value();
+            thread->wait_queue = nullptr;
+            // The thread could have been terminated while it was waiting
+            if (thread->state != ThreadState::BLOCKED
+                && thread->state != ThreadState::BLOCK_PENDING)
+                continue;
+            g_scheduler.unblock(thread);
+            if (g_scheduler.get_ready_queue()->peek() == thread.get()) next_is_woken = true;
+        }
+        return next_is_woken;
+    }
+
+    void WaitQueue::remove_waiter(const SharedPointer<Thread>& thread) {
+        CriticalSection<InterruptSaveLock> _(_lock);
+        _waiters.remove(thread);
+        thread->wait_queue = nullptr;
+    }
+} // namespace Rune::CPU
@@ -0,0 +1,197 @@
+/*
+ *  Copyright 2025 Ewogijk
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+#include <CPU/Threading/WaitSet.h>
+
+#include <CPU/Threading/CriticalSection.h>
+
+namespace Rune::CPU {
+    WaitSet::Entry::Entry(WaitSet* wait_set, WaitQueue* source, Function<bool(int&)> poll)
+        : wait_set(wait_set),
+          source(source),
+          poll(move(poll)) {}
+
+    auto WaitSet::Entry::notify() -> bool { return wait_set->signal(this); }
+
+    void WaitSet::queue_ready(Entry* entry) {
+        entry->next_ready = nullptr;
+        entry->is_queued  = true;
+        if (_ready_tail)
+            _ready_tail->next_ready = entry;
+        else
+            _ready_head = entry;
+        _ready_tail = entry;
+    }
+
+    void WaitSet::dequeue_ready(Entry* entry) {
+        if (!entry->is_queued) return;
+        Entry* prev = nullptr;
+        Entry* c    = _ready_head;
+        while (c != nullptr && c != entry) {
+            prev = c;
+            c    = c->next_ready;
+        }
+        if (c == nullptr) return;
+
+        if (prev)
+            prev->next_ready = entry->next_ready;
+        else
+            _ready_head = entry->next_ready;
+        if (_ready_tail == entry) _ready_tail = prev;
+        entry->next_ready = nullptr;
+        entry->is_queued  = false;
+    }
+
+    auto WaitSet::collect(Ember::WaitEvent* events, size_t size) -> size_t {
+        // Only visit the entries that are in the ready list right now, reported entries are
+        // appended again and must not be visited twice
+        Entry* last  = _ready_tail;
+        size_t count = 0;
+        while (_ready_head != nullptr && count < size) {
+            Entry* entry = _ready_head;
+            _ready_head  = entry->next_ready;
+            if (_ready_head == nullptr) _ready_tail = nullptr;
+            entry->next_ready = nullptr;
+            entry->is_queued  = false;
+
+            int result = 0;
+            if (entry->poll(result)) {
+                events[count]        = entry->event;
+                events[count].result = result;
+                count++;
+                queue_ready(entry);
+            } else if (!entry->source) {
+                // Nothing would queue the entry again
+                queue_ready(entry);
+            }
+            if (entry == last) break;
+        }
+        return count;
+    }
+
+    auto WaitSet::signal(Entry* entry) -> bool {
+        CriticalSection<InterruptSaveLock> _(_lock);
+        if (!entry->is_queued) queue_ready(entry);
+        if (!_waiter) return false;
+
+        SharedPointer<Thread> waiter = _waiter;
+        _waiter                      = SharedPointer<Thread>(nullptr);
+        // The waiter could have been woken by the timer or terminated in the meantime
+        if (waiter->state != ThreadState::BLOCKED && waiter->state != ThreadState::BLOCK_PENDING)
+            return false;
+        g_scheduler.unblock(waiter);
+        return g_scheduler.get_ready_queue()->peek() == waiter.get();
+    }
+
+    WaitSet::WaitSet(U16 handle)
+        : _handle(handle),
+          _ready_head(nullptr),
+          _ready_tail(nullptr),
+          _waiter(nullptr) {}
+
+    WaitSet::~WaitSet() {
+        for (auto& entry : _entries)
+            if (entry->source) entry->source->remove_watcher(entry.get());
+    }
+
+    auto WaitSet::get_handle() const -> U16 { return _handle; }
+
+    auto WaitSet::add(Ember::WaitEventType        type,
+                      U16                         resource,
+                      U64                         user_data,
+                      WaitQueue*                  source,
+                      const Function<bool(int&)>& poll) -> bool {
+        auto entry = SharedPointer<Entry>(new Entry(this, source, poll));
+        entry->event.type      = type;
+        entry->event.resource  = resource;
+        entry->event.user_data = user_data;
+        {
+            CriticalSection<InterruptSaveLock> _(_lock);
+            for (auto& e : _entries)
+                if (e->event.type == type && e->event.resource == resource) return false;
+            _entries.add_back(entry);
+        }
+
+        if (source) source->add_watcher(entry.get());
+        // The event could have happened before the entry watched the source -> Poll it with the
+        // next wait
+        CriticalSection<InterruptSaveLock> _(_lock);
+        if (!entry->is_queued) queue_ready(entry.get());
+        return true;
+    }
+
+    auto WaitSet::remove(Ember::WaitEventType type, U16 resource) -> bool {
+        SharedPointer<Entry> entry;
+        {
+            CriticalSection<InterruptSaveLock> _(_lock);
+            for (auto& e : _entries) {
+                if (e->event.type == type && e->event.resource == resource) {
+                    entry = e;
+                    break;
+                }
+            }
+        }
+        if (!entry) return false;
+
+        // Stop watching first, so the source cannot queue the entry again
+        if (entry->source) entry->source->remove_watcher(entry.get());
+        CriticalSection<InterruptSaveLock> _(_lock);
+        dequeue_ready(entry.get());
+        _entries.remove(entry);
+        return true;
+    }
+
+    auto WaitSet::wait(Ember::WaitEvent* events, size_t size, Timer* timer, U64 timeout_nanos)
+        -> int {
+        auto running_thread = g_scheduler.get_running_thread();
+        {
+            CriticalSection<InterruptSaveLock> _(_lock);
+            if (_waiter) return -1;
+
+            size_t count = collect(events, size);
+            if (count > 0 || timeout_nanos == 0) return static_cast<int>(count);
+
+            // Interrupts are disabled, so neither the timer nor an event source can wake the
+            // thread before it is marked
+            if (timeout_nanos != Ember::WAIT_FOREVER) {
+                U64 now       = timer->get_time_since_start();
+                U64 wake_time = timeout_nanos < Ember::WAIT_FOREVER - now
+                                    ? now + timeout_nanos
+                                    : Ember::WAIT_FOREVER;
+                if (!timer->schedule_wake_up(wake_time)) return 0;
+            }
+            g_scheduler.mark_as_block_pending();
+            _waiter                  = running_thread;
+            running_thread->wait_set = this;
+        }
+        g_scheduler.block();
+
+        CriticalSection<InterruptSaveLock> _(_lock);
+        _waiter                  = SharedPointer<Thread>(nullptr);
+        running_thread->wait_set = nullptr;
+        // Woken by an event before the timeout expired
+        if (running_thread->timer_handle != Resource<TimerHandle>::HANDLE_NONE) {
+            timer->remove_sleeping_thread(running_thread->get_handle());
+            running_thread->timer_handle = Resource<TimerHandle>::HANDLE_NONE;
+        }
+        return static_cast<int>(collect(events, size));
+    }
+
+    void WaitSet::remove_waiter(const SharedPointer<Thread>& thread) {
+        CriticalSection<InterruptSaveLock> _(_lock);
+        if (_waiter == thread) _waiter = SharedPointer<Thread>(nullptr);
+        thread->wait_set = nullptr;
+    }
+} // namespace Rune::CPU
@@ -90,12 +90,19 @@ namespace Rune::CPU {
         _irq_handler = [this](InterruptFrame* i_frame) -> Rune::CPU::InterruptState::_E {
             SILENCE_UNUSED(i_frame)
             _count++;
+            publish_kernel_clock(_count);
             _sleeping_threads.update_wake_time(_time_between_irq);
             bool do_preempt = false;
             auto c_t        = _sleeping_threads.dequeue();
             while (c_t) {
                 LOGGER->trace(R"(1-{}: {} wake up)", get_name(), c_t->get_unique_name());
                 c_t->timer_handle = Resource<TimerHandle>::HANDLE_NONE;
+                // The thread could have been woken by another event, e.g. of a wait set
+                if (c_t->state != ThreadState::BLOCKED
+                    && c_t->state != ThreadState::BLOCK_PENDING) {
+                    c_t = _sleeping_threads.dequeue();
+                    continue;
+                }
                 _scheduler->unblock(c_t);
                 if (_scheduler->get_ready_queue()->peek() == c_t.get())
                     do_preempt = true; // Execute the thread immediately if it is first in the
@@ -148,4 +155,18 @@ namespace Rune::CPU {
         _quantum_remaining           = _quantum; // Reset the quantum remaining for the next thread
         _scheduler->block();
     }
+
+    auto PIT::schedule_wake_up(U64 wake_time_nanos) -> bool {
+        U64 tsb = get_time_since_start();
+        if (wake_time_nanos <= tsb) return false;
+
+        auto& calling_thread = _scheduler->get_running_thread();
+        LOGGER->trace(R"(1-{}: {} wake up in {}ns)",
+                      get_name(),
+                      calling_thread->get_unique_name(),
+                      wake_time_nanos - tsb);
+        _sleeping_threads.enqueue(calling_thread, wake_time_nanos - tsb);
+        calling_thread->timer_handle = 1;
+        return true;
+    }
 } // namespace Rune::CPU
\ No newline at end of file
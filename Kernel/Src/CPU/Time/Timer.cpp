@@ -19,7 +19,23 @@
 namespace Rune::CPU {
     DEFINE_ENUM(TimerMode, TIMER_MODES, 0x0)
 
-    Timer::Timer() : _mode(TimerMode::NONE), _freq_hz(0), _quantum(0) {}
+    Timer::Timer() : _mode(TimerMode::NONE), _freq_hz(0), _quantum(0), _kernel_clock(nullptr) {}
+
+    void Timer::publish_kernel_clock(U64 tick_count) {
+        if (_kernel_clock == nullptr) return;
+
+        // Sequence lock write side: Readers retry while the sequence is odd or has changed
+        U32 seq = __atomic_load_n(&_kernel_clock->sequence, __ATOMIC_RELAXED);
+        __atomic_store_n(&_kernel_clock->sequence, seq + 1, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        __atomic_store_n(&_kernel_clock->tick_count, tick_count, __ATOMIC_RELAXED);
+        __atomic_store_n(&_kernel_clock->time_since_start,
+                         get_time_since_start(),
+                         __ATOMIC_RELAXED);
+        __atomic_store_n(&_kernel_clock->sequence, seq + 2, __ATOMIC_RELEASE);
+    }
+
+    void Timer::set_kernel_clock(Ember::KernelClock* kernel_clock) { _kernel_clock = kernel_clock; }
 
     auto Timer::get_frequency() const -> U64 { return _freq_hz; }
 
@@ -19,6 +19,7 @@
 #include <Ember/AppBits.h>
 
 #include <CPU/IO.h>
+#include <CPU/Threading/Atomic.h>
 
 namespace Rune::Device {
 #define PORTS(X)                                                                                   \
@@ -124,16 +125,28 @@ namespace Rune::Device {
               return CPU::InterruptState::PENDING;
           }) {}
 
+    auto PS2Keyboard::has_input() -> bool {
+        return CPU::atomic_load_relaxed(&_start) != CPU::atomic_load_acquire(&_end);
+    }
+
     auto PS2Keyboard::read() -> int {
-        if (_start == _end) return Ember::VirtualKey::NONE_KEY_CODE;
-        int key_code = _key_code_cache[_start];
-        _start       = (_start + 1) % RING_BUFFER_SIZE;
+        const int start = CPU::atomic_load_relaxed(&_start);
+        if (start == CPU::atomic_load_acquire(&_end)) return Ember::VirtualKey::NONE_KEY_CODE;
+        int key_code = _key_code_cache[start];
+        CPU::atomic_store_release(&_start, (start + 1) % static_cast<int>(RING_BUFFER_SIZE));
         return key_code;
     }
 
+    auto PS2Keyboard::wait_for_input() -> bool {
+        while (!has_input()) _readers.wait([this] { return has_input(); });
+        return true;
+    }
+
+    auto PS2Keyboard::get_input_wait_queue() -> CPU::WaitQueue* { return &_readers; }
+
     void PS2Keyboard::flush() {
-        _start = 0;
-        _end   = 0;
+        // Only the reader side may be moved, the IRQ handler owns the end
+        CPU::atomic_store_release(&_start, CPU::atomic_load_acquire(&_end));
     }
 
     auto PS2Keyboard::vendor() const -> String { return "Ewogjik"; };
@@ -156,11 +169,20 @@ namespace Rune::Device {
 
             Ember::VirtualKey key =
                 _wait_key_e0 ? E_0_SCAN_CODE_DECODER[scan_code] : SCAN_CODE_DECODER[scan_code];
-            if (!key.is_none()) {
-                _key_code_cache[_end] = key.get_key_code();
-                _end                  = (_end + 1) % RING_BUFFER_SIZE;
-
-                if (_wait_key_e0) _wait_key_e0 = false;
+            if (key.is_none()) return CPU::InterruptState::HANDLED;
+            if (_wait_key_e0) _wait_key_e0 = false;
+
+            const int end  = CPU::atomic_load_relaxed(&_end);
+            const int next = (end + 1) % static_cast<int>(RING_BUFFER_SIZE);
+            if (next == CPU::atomic_load_acquire(&_start))
+                return CPU::InterruptState::HANDLED; // Buffer is full -> Drop the key
+            _key_code_cache[end] = key.get_key_code();
+            CPU::atomic_store_release(&_end, next);
+
+            if (_readers.wake_all()) {
+                // A reader runs next -> Switch to it now instead of waiting for the next quantum
+                CPU::irq_send_eoi();
+                CPU::g_scheduler.preempt_running_thread();
             }
             return CPU::InterruptState::HANDLED;
         };
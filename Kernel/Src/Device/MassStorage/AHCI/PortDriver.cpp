@@ -57,20 +57,26 @@ namespace Rune::Device {
             return p.get_future();
         }
 
-        auto port_engine = ahci_device->port_engine();
-        if (req->m_type == MassStorageDeviceRequestType::READ) {
-            auto read_dma_FIS = RegisterHost2DeviceFIS::ReadDMAExtended(
-                dev_lba,
-                div_round_up(req->m_buffer_size, static_cast<size_t>(ahci_device->sector_size())));
-            *static_cast<size_t*>(request.m_out_buffer) =
-                port_engine->send_ata_command(req->m_buffer, req->m_buffer_size, read_dma_FIS);
-        } else {
-            auto write_dma_FIS = RegisterHost2DeviceFIS::WriteDMAExtended(
-                dev_lba,
-                div_round_up(req->m_buffer_size, static_cast<size_t>(ahci_device->sector_size())));
-            *static_cast<size_t*>(request.m_out_buffer) =
-                port_engine->send_ata_command(req->m_buffer, req->m_buffer_size, write_dma_FIS);
+        // Split the request into commands the port engine can describe in a single PRDT
+        auto   port_engine  = ahci_device->port_engine();
+        auto   sector_size  = static_cast<size_t>(ahci_device->sector_size());
+        size_t max_transfer = port_engine->max_transfer_size() / sector_size * sector_size;
+        auto*  buf          = static_cast<U8*>(req->m_buffer);
+        size_t transferred  = 0;
+        while (transferred < req->m_buffer_size) {
+            size_t chunk_size   = min(req->m_buffer_size - transferred, max_transfer);
+            size_t chunk_lba    = dev_lba + (transferred / sector_size);
+            auto   sector_count = static_cast<U16>(div_round_up(chunk_size, sector_size));
+            RegisterHost2DeviceFIS fis =
+                req->m_type == MassStorageDeviceRequestType::READ
+                    ? RegisterHost2DeviceFIS::ReadDMAExtended(chunk_lba, sector_count)
+                    : RegisterHost2DeviceFIS::WriteDMAExtended(chunk_lba, sector_count);
+            size_t chunk_transferred =
+                port_engine->send_ata_command(&buf[transferred], chunk_size, fis);
+            transferred += chunk_transferred;
+            if (chunk_transferred < chunk_size) break;
         }
+        *static_cast<size_t*>(request.m_out_buffer) = transferred;
         p.set_value(IORequestStatus::HANDLED);
         return p.get_future();
     }
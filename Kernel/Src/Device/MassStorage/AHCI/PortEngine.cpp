@@ -45,6 +45,7 @@ namespace Rune::Device {
     static constexpr size_t MODEL_NUMBER_SIZE           = 20;
     static constexpr size_t IDENTIFY_DEVICE_BUFFER_SIZE = 256;
     static constexpr size_t DEFAULT_SECTOR_SIZE         = 512;
+    static constexpr size_t MAX_PRDT_BYTE_COUNT         = 4 * MemoryUnit::MiB;
 
     static constexpr U8 SERIAL_NUMBER_OFFSET                = 10;
     static constexpr U8 FIRMWARE_REVISION_OFFSET            = 23;
@@ -239,6 +240,11 @@ namespace Rune::Device {
         }
     }
 
+    auto PortEngine::max_transfer_size() const -> size_t {
+        // An unaligned buffer touches one more page than its size in pages
+        return (CommandTable::PRDT_ENTRY_COUNT - 1) * Memory::get_page_size();
+    }
+
     auto PortEngine::send_ata_command(void* buf, size_t bufSize, RegisterHost2DeviceFIS h2dFis)
         -> size_t {
         int slot  = -1;
@@ -256,19 +262,40 @@ namespace Rune::Device {
         request.buf_size           = bufSize;
         request.status.CommandSlot = slot;
 
-        PhysicalAddr p_buf{0};
-        if (!Memory::virtual_to_physical_address(memory_pointer_to_addr(request.buf), p_buf))
-            return 0;
-
-        CommandTable& ct        = _system_memory->CT[slot];
-        ct.PRDT[0].DBA.AsUInt32 = static_cast<U32>(p_buf);
-        if (ct.PRDT[0].DBA.Reserved != 0) return 0;
-
+        // Describe the buffer page by page, physically contiguous pages share a PRDT entry
+        CommandTable& ct          = _system_memory->CT[slot];
+        U16           prdt_length = 0;
+        PhysicalAddr  p_end{0};
+        VirtualAddr   v_buf     = memory_pointer_to_addr(request.buf);
+        size_t        remaining = bufSize;
+        size_t        page_size = Memory::get_page_size();
+        while (remaining > 0) {
+            PhysicalAddr p_buf{0};
+            if (!Memory::virtual_to_physical_address(v_buf, p_buf)) return 0;
+            size_t segment_size = min(remaining, page_size - (v_buf % page_size));
+
+            if (prdt_length > 0 && p_buf == p_end
+                && ct.PRDT[prdt_length - 1].DBC + 1 + segment_size <= MAX_PRDT_BYTE_COUNT) {
+                ct.PRDT[prdt_length - 1].DBC += segment_size;
+            } else {
+                if (prdt_length == CommandTable::PRDT_ENTRY_COUNT) return 0;
+
+                PRDTEntry& prd   = ct.PRDT[prdt_length++];
+                prd.DBA.AsUInt32 = static_cast<U32>(p_buf);
+                if (prd.DBA.Reserved != 0) return 0;
+                prd.DBAU = 0;
 #ifdef IS_64_BIT
-        if (_s64a) ct.PRDT[0].DBAU = (U32) (p_buf >> 32);
+                if (_s64a) prd.DBAU = (U32) (p_buf >> 32);
 #endif
-        ct.PRDT[0].DBC = Request::INTERNAL_BUF_SIZE - 1;
-        ct.PRDT[0].I   = 1;
+                prd.DBC = segment_size - 1;
+                prd.I   = 0;
+            }
+            p_end      = p_buf + segment_size;
+            v_buf     += segment_size;
+            remaining -= segment_size;
+        }
+        if (prdt_length > 0) ct.PRDT[prdt_length - 1].I = 1;
+        _system_memory->CL[slot].PRDTL = prdt_length;
 
         ct.CFIS                      = h2dFis;
         _system_memory->CL[slot].CFL = sizeof(RegisterHost2DeviceFIS) / sizeof(U32);
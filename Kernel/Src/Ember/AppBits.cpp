@@ -25,6 +25,10 @@ namespace Ember {
 
     DEFINE_ENUM(StdIOTarget, STD_IO_TARGETS, 0x0)
 
+    DEFINE_ENUM(StdinReadMode, STDIN_READ_MODES, 0x0)
+
+    DEFINE_ENUM(WaitEventType, WAIT_EVENT_TYPES, 0x0)
+
     const VirtualKey VirtualKey::NONE = VirtualKey();
 
     auto VirtualKey::build(const U8 row, const U8 col, bool released) -> VirtualKey {
@@ -21,6 +21,8 @@ namespace Ember {
 
     DEFINE_ENUM(SeekMode, SEEK_MODE, 0x0)
 
+    DEFINE_TYPED_ENUM(IORingOp, U8, IO_RING_OPS, 0x0)
+
     //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
     //                                          VFSNodeInfo
     //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
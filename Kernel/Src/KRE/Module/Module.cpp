@@ -16,7 +16,11 @@
 
 #include <KRE/System/Module.h>
 
+#include <KRE/Logging.h>
+
 namespace Rune {
+    const SharedPointer<Logger> LOGGER = LogContext::instance().get_logger("KRE.Module");
+
     //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
     //                                          Version
     //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -31,11 +35,24 @@ namespace Rune {
     //                                          Kernel Subsystem
     //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 
-    void Module::fire(const String& evt_hook, void* evt_context) {
-        auto it = _event_hook_table.find(evt_hook);
-        if (it == _event_hook_table.end()) return;
+    void Module::add_event_hook(const U8 evt_hook, const char* name) {
+        if (evt_hook >= MAX_EVENT_HOOK_COUNT) {
+            LOGGER->warn(R"(Cannot add event hook "{}": ID {} exceeds the event hook table )"
+                         R"(size {}.)",
+                         name,
+                         evt_hook,
+                         MAX_EVENT_HOOK_COUNT);
+            return;
+        }
+        _event_hook_table[evt_hook].name = name;
+    }
+
+    void Module::fire(const U8 evt_hook, void* evt_context) {
+        if (evt_hook >= MAX_EVENT_HOOK_COUNT) return;
 
-        for (auto& entry : *it->value) {
+        EventHookSlot& slot = _event_hook_table[evt_hook];
+        for (U8 i = 0; i < slot.handler_count; i++) {
+            EventHandlerTableEntry& entry = slot.handlers[i];
             entry.notified++;
             entry.handler(forward<void*>(evt_context));
         }
@@ -45,10 +62,14 @@ namespace Rune {
 
     auto Module::get_event_hook_table() -> LinkedList<EventHookTableEntry> {
         LinkedList<EventHookTableEntry> evt_hook_tbl;
-        for (const auto& e : _event_hook_table) {
+        for (U8 evt_hook = 0; evt_hook < MAX_EVENT_HOOK_COUNT; evt_hook++) {
+            const EventHookSlot& slot = _event_hook_table[evt_hook];
+            if (slot.name == nullptr) continue;
+
             EventHookTableEntry evt_hook_tbl_e;
-            evt_hook_tbl_e.event_hook = *e.key; // NOLINT only end() will be null
-            for (auto& ee : *e.value) {
+            evt_hook_tbl_e.event_hook = slot.name;
+            for (U8 i = 0; i < slot.handler_count; i++) {
+                const EventHandlerTableEntry& ee = slot.handlers[i];
                 evt_hook_tbl_e.event_handler_table.add_back(
                     {.handle = ee.handle, .name = ee.name, .notified = ee.notified});
             }
@@ -58,30 +79,50 @@ namespace Rune {
         return evt_hook_tbl;
     }
 
-    auto Module::install_event_handler(const String&       event_hook,
+    auto Module::install_event_handler(const U8            event_hook,
                                        const String&       evt_handler_name,
                                        const EventHandler& handler) -> U16 {
-        if (!_event_hook_handle_counter.has_more()) return 0;
+        if (!_event_hook_handle_counter.has_more()) {
+            LOGGER->warn(R"(Cannot install event handler "{}": No more event handler IDs.)",
+                         evt_handler_name);
+            return 0;
+        }
+        if (event_hook >= MAX_EVENT_HOOK_COUNT || _event_hook_table[event_hook].name == nullptr) {
+            LOGGER->warn(R"(Cannot install event handler "{}": Unknown event hook {}.)",
+                         evt_handler_name,
+                         event_hook);
+            return 0;
+        }
 
-        auto it = _event_hook_table.find(event_hook);
-        if (it == _event_hook_table.end()) return 0;
+        EventHookSlot& slot = _event_hook_table[event_hook];
+        if (slot.handler_count == MAX_EVENT_HANDLER_COUNT) {
+            LOGGER->warn(R"(Cannot install event handler "{}": Event hook "{}" already has {} )"
+                         R"(event handlers.)",
+                         evt_handler_name,
+                         slot.name,
+                         MAX_EVENT_HANDLER_COUNT);
+            return 0;
+        }
 
-        U16 evt_handler_id = _event_hook_handle_counter.acquire();
-        it->value->add_back({.handle   = evt_handler_id,
-                             .name     = evt_handler_name,
-                             .notified = 0,
-                             .handler  = handler});
+        U16 evt_handler_id                 = _event_hook_handle_counter.acquire();
+        slot.handlers[slot.handler_count++] = {.handle   = evt_handler_id,
+                                               .name     = evt_handler_name,
+                                               .notified = 0,
+                                               .handler  = handler};
         return evt_handler_id;
     }
 
-    auto Module::uninstall_event_handler(const String& event_hook, U16 evt_handler_id) -> bool {
-        auto it = _event_hook_table.find(event_hook);
-        if (it == _event_hook_table.end()) return false;
+    auto Module::uninstall_event_handler(const U8 event_hook, U16 evt_handler_id) -> bool {
+        if (event_hook >= MAX_EVENT_HOOK_COUNT) return false;
 
-        EventHandlerTableEntry to_remove;
-        for (const auto& entry : *it->value) {
-            if (entry.handle == evt_handler_id) {
-                it->value->remove(entry);
+        EventHookSlot& slot = _event_hook_table[event_hook];
+        for (U8 i = 0; i < slot.handler_count; i++) {
+            if (slot.handlers[i].handle == evt_handler_id) {
+                // Keep the installation order of the remaining event handlers
+                for (U8 j = i + 1; j < slot.handler_count; j++)
+                    slot.handlers[j - 1] = move(slot.handlers[j]);
+                slot.handler_count--;
+                slot.handlers[slot.handler_count] = EventHandlerTableEntry();
                 return true;
             }
         }
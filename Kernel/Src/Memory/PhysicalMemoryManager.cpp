@@ -53,7 +53,8 @@ namespace Rune::Memory {
     }
 
     PhysicalMemoryManager::PhysicalMemoryManager()
-        : _page_size(0),
+        : _shared_frames(),
+          _page_size(0),
           _mem_base(0),
           _mem_size(0),
           _mem_map(nullptr),
@@ -124,5 +125,28 @@ namespace Rune::Memory {
         return allocate_explicit(p_addr, 1);
     }
 
-    auto PhysicalMemoryManager::free(PhysicalAddr p_addr) -> bool { return free(p_addr, 1); }
+    auto PhysicalMemoryManager::free(PhysicalAddr p_addr) -> bool {
+        auto it = _shared_frames.find(p_addr);
+        if (it != _shared_frames.end()) {
+            // Drop a reference, the page frame is still used by someone else
+            if (--(*it->value) == 0) _shared_frames.remove(p_addr);
+            return true;
+        }
+        return free(p_addr, 1);
+    }
+
+    auto PhysicalMemoryManager::share(PhysicalAddr p_addr) -> bool {
+        if (p_addr < _mem_base || to_page_frame(p_addr) >= _mem_size) return false;
+        auto it = _shared_frames.find(p_addr);
+        if (it != _shared_frames.end())
+            (*it->value)++;
+        else
+            _shared_frames.put(p_addr, 1);
+        return true;
+    }
+
+    auto PhysicalMemoryManager::get_reference_count(PhysicalAddr p_addr) const -> U32 {
+        auto it = _shared_frames.find(p_addr);
+        return it != _shared_frames.end() ? *it->value + 1 : 1;
+    }
 } // namespace Rune::Memory
\ No newline at end of file
@@ -106,6 +106,47 @@ namespace Rune::Memory {
         return true;
     }
 
+    auto VirtualMemoryManager::clone_virtual_address_space_rec(PageTable src, PageTable dst)
+        -> bool {
+        // Same as for freeing, the kernel half of the base page table is shared and not cloned
+        U16 clone_limit = PageTable::get_size();
+        if (src.is_base_page_table()) clone_limit /= 2;
+        for (U16 i = 0; i < clone_limit; i++) {
+            PageTableEntry pte = src[i];
+            if (!pte.is_present()) continue;
+
+            if (pte.is_pointing_to_page_frame()) {
+                // Share the frame before the source page becomes copy-on-write, otherwise a write
+                // fault of another thread of the source app would still see a single owner and
+                // make the page writable in place
+                if (!_pmm->share(pte.get_address())) {
+                    LOGGER->warn("Failed to share page frame {:0=#16x}", pte.get_address());
+                    return false;
+                }
+                NativePageTableEntry n_pte = pte.native_entry;
+                if (pte.is_write_allowed()) {
+                    n_pte = (n_pte & ~PageFlag::WRITE_ALLOWED) | PageFlag::COPY_ON_WRITE;
+                    src.update(i, n_pte);
+                }
+                dst.update(i, n_pte);
+            } else {
+                PhysicalAddr pt_frame = 0;
+                if (!_pmm->allocate(pt_frame)) {
+                    LOGGER->warn("Page table allocation fail: Out of physical memory.");
+                    return false;
+                }
+                memset(memory_addr_to_pointer<void>(physical_to_virtual_address(pt_frame)),
+                       0,
+                       get_page_size());
+                dst.update(i, pt_frame | pte.get_flags());
+                if (!clone_virtual_address_space_rec(src.entry_as_page_table(i),
+                                                     dst.entry_as_page_table(i)))
+                    return false;
+            }
+        }
+        return true;
+    }
+
     VirtualMemoryManager::VirtualMemoryManager(PhysicalMemoryManager* pmm)
         : _pmm(pmm),
           _start_fail(VMMStartFailure::NONE),
@@ -114,7 +155,8 @@ namespace Rune::Memory {
     auto VirtualMemoryManager::start(MemoryMap*        p_map,
                                      MemoryMap*        v_map,
                                      KernelSpaceLayout k_space_layout,
-                                     MemorySize        heap_size) -> VMMStartFailure {
+                                     MemorySize        heap_size,
+                                     MemorySize        kernel_stacks_size) -> VMMStartFailure {
         U16          p_flags = PageFlag::PRESENT | PageFlag::WRITE_ALLOWED;
         PhysicalAddr base_pt_addr{0};
         if (!_pmm->allocate(base_pt_addr)) {
@@ -181,6 +223,22 @@ namespace Rune::Memory {
             return _start_fail;
         }
 
+        // Kernel stacks are mapped on demand by the kernel stack allocator
+        MemoryRegion kernel_stacks = {.start       = k_space_layout.kernel_stacks,
+                                      .size        = kernel_stacks_size,
+                                      .memory_type = MemoryRegionType::KERNEL_STACKS};
+        if (!v_map->claim(kernel_stacks, get_page_size())) {
+            _start_fail = VMMStartFailure::KERNEL_STACKS_MAPPING_FAIL;
+            _ksear      = {
+                .region      = "Kernel Stacks",
+                .has_error   = true,
+                .alloc_pta   = {.status = PageTableAccessStatus::OKAY, .path = {}},
+                .free_pta    = {.status = PageTableAccessStatus::OKAY, .path = {}},
+                .claim_error = true
+            };
+            return _start_fail;
+        }
+
         // Create kernel code kernel space entries
         ksear = allocate_kernel_space_entries(base_pt,
                                               k_space_layout.kernel_code,
@@ -237,6 +295,56 @@ namespace Rune::Memory {
             interp_as_base_page_table(base_pt_addr).to_page_table_entry());
     }
 
+    auto VirtualMemoryManager::clone_virtual_address_space(PhysicalAddr  src_base_pt_addr,
+                                                           PhysicalAddr& base_pt_addr) -> bool {
+        PhysicalAddr clone_addr{0};
+        if (!allocate_virtual_address_space(clone_addr)) return false;
+
+        bool cloned = clone_virtual_address_space_rec(interp_as_base_page_table(src_base_pt_addr),
+                                                      interp_as_base_page_table(clone_addr));
+        // Writable pages of the source are read-only now -> Stale TLB entries must go
+        if (src_base_pt_addr == get_base_page_table_address()) flush_tlb();
+        if (!cloned) {
+            // Pages of the source stay copy-on-write, the first write will find that the page
+            // frame is not shared anymore and simply makes the page writable again
+            free_virtual_address_space(clone_addr);
+            _pmm->free(clone_addr);
+            return false;
+        }
+
+        base_pt_addr = clone_addr;
+        return true;
+    }
+
+    auto VirtualMemoryManager::resolve_copy_on_write(const PageTable& base_pt, VirtualAddr v_addr)
+        -> bool {
+        const MemorySize page_size = get_page_size();
+        const VirtualAddr page      = v_addr - (v_addr % page_size);
+        PageTableAccess   pta       = find_page(base_pt, page);
+        if (pta.status != PageTableAccessStatus::OKAY || !pta.path[0].is_copy_on_write())
+            return false;
+
+        PhysicalAddr frame = pta.path[0].get_address();
+        const U16    flags = (pta.path[0].get_flags() | PageFlag::WRITE_ALLOWED)
+                          & ~PageFlag::COPY_ON_WRITE;
+        if (_pmm->get_reference_count(frame) > 1) {
+            // Another virtual address space still references the page frame -> Copy it
+            PhysicalAddr copy{0};
+            if (!_pmm->allocate(copy)) {
+                LOGGER->warn("Copy-on-write fail: Out of physical memory for {:0=#16x}.", page);
+                return false;
+            }
+            memcpy(memory_addr_to_pointer<void>(physical_to_virtual_address(copy)),
+                   memory_addr_to_pointer<void>(physical_to_virtual_address(frame)),
+                   page_size);
+            _pmm->free(frame); // Drop the reference of this virtual address space
+            frame = copy;
+        }
+        remap_page(base_pt, page, frame, flags);
+        invalidate_page(page);
+        return true;
+    }
+
     void VirtualMemoryManager::load_virtual_address_space(PhysicalAddr base_pt_addr) { // NOLINT
         if (base_pt_addr != get_base_page_table_address()) {
             PageTable new_base_pt    = interp_as_base_page_table(base_pt_addr);
@@ -19,15 +19,30 @@
 #include <Ember/AppBits.h>
 #include <Ember/Ember.h>
 
+#include <KRE/Math.h>
+
+#include <SystemCall/SystemCall.h>
+
 namespace Rune::SystemCall {
+    constexpr U64 STDIN_POLL_INTERVAL   = 2; // 1ms is too fast, dunno why but nothing happens
+    constexpr U64 STD_STREAM_CHUNK_SIZE = 512;
+    constexpr U64 MILLI_TO_NANO         = 1000000;
+
+    void wait_for_stdin(const AppSystemCallContext* app_syscall_ctx,
+                        const SharedPointer<TextStream>& std_in) {
+        if (std_in->wait_for_input()) return;
+        // The stream cannot block -> Poll it
+        app_syscall_ctx->cpu_module->get_system_timer()->sleep_milli(STDIN_POLL_INTERVAL);
+    }
+
     auto read_stdin(void* sys_call_ctx, const U64 key_code_out) -> Ember::StatusCode {
         const auto* app_syscall_ctx = static_cast<AppSystemCallContext*>(sys_call_ctx);
-        auto*       timer           = app_syscall_ctx->cpu_module->get_system_timer();
+        const auto  std_in          = app_syscall_ctx->app_module->get_active_app()->std_in;
 
-        Ember::VirtualKey key(app_syscall_ctx->app_module->get_active_app()->std_in->read());
+        Ember::VirtualKey key(std_in->read());
         while (key.is_none()) {
-            timer->sleep_milli(2); // 1ms is too fast, dunno why but nothing happens
-            key = Ember::VirtualKey(app_syscall_ctx->app_module->get_active_app()->std_in->read());
+            wait_for_stdin(app_syscall_ctx, std_in);
+            key = Ember::VirtualKey(std_in->read());
         }
         U16   key_code        = key.get_key_code();
         auto* key_code_buffer = reinterpret_cast<U16*>(key_code_out);
@@ -39,40 +54,86 @@ namespace Rune::SystemCall {
                    : Ember::Status::BAD_ARG;
     }
 
-    auto write_stdout(void* sys_call_ctx, const U64 msg, const U64 msg_size) -> Ember::StatusCode {
+    auto read_stdin_keys(void*     sys_call_ctx,
+                         const U64 key_code_buf,
+                         const U64 key_code_buf_size,
+                         const U64 read_mode) -> Ember::StatusCode {
         const auto* app_syscall_ctx = static_cast<AppSystemCallContext*>(sys_call_ctx);
+        const auto  std_in          = app_syscall_ctx->app_module->get_active_app()->std_in;
+        if (key_code_buf_size == 0) return Ember::Status::BAD_ARG;
+        const Ember::StdinReadMode k_read_mode(read_mode);
+        if (k_read_mode != Ember::StdinReadMode::BLOCKING
+            && k_read_mode != Ember::StdinReadMode::NON_BLOCKING)
+            return Ember::Status::BAD_ARG;
 
-        const char* k_buf_msg = new char[msg_size + 1];
-        if (!app_syscall_ctx->k_guard->copy_string_user_to_kernel(
-                reinterpret_cast<const char*>(msg),
-                static_cast<int>(msg_size),
-                k_buf_msg))
+        const size_t key_limit =
+            min(key_code_buf_size, static_cast<U64>(Ember::STDIN_READ_KEY_LIMIT));
+        Array<U16, Ember::STDIN_READ_KEY_LIMIT> k_key_codes;
+        size_t                                  key_count = 0;
+        while (true) {
+            // Take everything that is buffered, so a burst of keys is returned by a single call
+            while (key_count < key_limit) {
+                Ember::VirtualKey key(std_in->read());
+                if (key.is_none()) break;
+                k_key_codes[key_count++] = key.get_key_code();
+            }
+            if (key_count > 0 || k_read_mode == Ember::StdinReadMode::NON_BLOCKING) break;
+            wait_for_stdin(app_syscall_ctx, std_in);
+        }
+        if (key_count == 0) return 0;
+
+        return app_syscall_ctx->k_guard->copy_byte_buffer_kernel_to_user(
+                   reinterpret_cast<void*>(k_key_codes.data()),
+                   reinterpret_cast<void*>(key_code_buf),
+                   key_count * sizeof(U16))
+                   ? static_cast<Ember::StatusCode>(key_count)
+                   : Ember::Status::BAD_ARG;
+    }
+
+    auto write_std_stream(const AppSystemCallContext* app_syscall_ctx,
+                          TextStream&                 std_stream,
+                          const U64                   msg,
+                          const U64                   msg_size) -> Ember::StatusCode {
+        auto* u_msg = reinterpret_cast<char*>(msg);
+        if (u_msg == nullptr) return Ember::Status::BAD_ARG;
+        if (msg_size == 0) return 0;
+        if (!app_syscall_ctx->k_guard->pin_user_buffer(u_msg, msg_size, false))
             return Ember::Status::BAD_ARG;
-        const String k_msg(k_buf_msg);
-        const auto   byte_out = static_cast<Ember::StatusCode>(
-            app_syscall_ctx->app_module->get_active_app()->std_out->write(k_msg));
-        delete[] k_buf_msg;
-        return byte_out;
+
+        // Write the user memory directly in chunks, a chunk is rendered as one batch and the stream
+        // is not locked for too long
+        size_t bytes_written = 0;
+        while (bytes_written < msg_size) {
+            // The msg is a C string -> Stop at the null terminator
+            const size_t chunk_size   = min(msg_size - bytes_written, STD_STREAM_CHUNK_SIZE);
+            size_t       chunk_length = 0;
+            while (chunk_length < chunk_size && u_msg[bytes_written + chunk_length] != '\0')
+                chunk_length++;
+            const size_t chunk_written =
+                std_stream.write_buffer(&u_msg[bytes_written], chunk_length);
+            bytes_written += chunk_written;
+            if (chunk_written < chunk_size) break;
+        }
+        return static_cast<Ember::StatusCode>(bytes_written);
     }
 
-    auto write_stderr(void* sys_call_ctx, const U64 msg, const U64 msg_size) -> Ember::StatusCode {
+    auto write_stdout(void* sys_call_ctx, const U64 msg, const U64 msg_size) -> Ember::StatusCode {
         const auto* app_syscall_ctx = static_cast<AppSystemCallContext*>(sys_call_ctx);
+        return write_std_stream(app_syscall_ctx,
+                                *app_syscall_ctx->app_module->get_active_app()->std_out,
+                                msg,
+                                msg_size);
+    }
 
-        const char* k_buf_msg = new char[msg_size + 1];
-        if (!app_syscall_ctx->k_guard->copy_string_user_to_kernel(
-                reinterpret_cast<const char*>(msg),
-                static_cast<int>(msg_size),
-                k_buf_msg))
-            return Ember::Status::BAD_ARG;
-        const String                    k_msg(k_buf_msg);
+    auto write_stderr(void* sys_call_ctx, const U64 msg, const U64 msg_size) -> Ember::StatusCode {
+        const auto* app_syscall_ctx = static_cast<AppSystemCallContext*>(sys_call_ctx);
         const SharedPointer<TextStream> std_err =
             app_syscall_ctx->app_module->get_active_app()->std_err;
 
         std_err->set_foreground_color(Pixie::VSCODE_RED);
-        const auto byte_out = static_cast<Ember::StatusCode>(
-            app_syscall_ctx->app_module->get_active_app()->std_err->write(k_msg));
+        const Ember::StatusCode byte_out =
+            write_std_stream(app_syscall_ctx, *std_err, msg, msg_size);
         std_err->reset_style();
-        delete[] k_buf_msg;
         return byte_out;
     }
 
@@ -209,6 +270,22 @@ namespace Rune::SystemCall {
         return ID;
     }
 
+    auto app_clone(void* sys_call_ctx, const U64 entry, const U64 stack_top) -> Ember::StatusCode {
+        const auto* app_syscall_ctx = static_cast<AppSystemCallContext*>(sys_call_ctx);
+        auto*       u_entry         = reinterpret_cast<void*>(entry);
+        auto*       u_stack_top     = reinterpret_cast<void*>(stack_top);
+        if (!app_syscall_ctx->k_guard->verify_user_buffer(u_entry, 1)
+            || !app_syscall_ctx->k_guard->verify_user_buffer(u_stack_top, 0))
+            return Ember::Status::BAD_ARG;
+
+        auto [load_result, ID] = app_syscall_ctx->app_module->clone_active_app(
+            reinterpret_cast<CPU::ThreadMain>(entry),
+            stack_top);
+        if (load_result != App::LoadStatus::RUNNING) return Ember::Status::FAULT;
+
+        return ID;
+    }
+
     auto app_exit(void* sys_call_ctx, const U64 exit_code) -> Ember::StatusCode {
         const auto* app_syscall_ctx = static_cast<AppSystemCallContext*>(sys_call_ctx);
         const int   k_exit_code     = static_cast<int>(exit_code);
@@ -276,4 +353,256 @@ namespace Rune::SystemCall {
             default: return Ember::Status::IO_ERROR;  // DEV_UNKNOWN, DEV_ERROR, OUT_OF_HANDLES
         }
     }
+
+    auto wait_set_create(void* sys_call_ctx) -> Ember::StatusCode {
+        const auto* app_syscall_ctx = static_cast<AppSystemCallContext*>(sys_call_ctx);
+        App::Info*  app             = app_syscall_ctx->app_module->get_active_app();
+        const U16   handle          = app->wait_set_table.acquire();
+        if (handle == Resource<U16>::HANDLE_NONE) return Ember::Status::FAULT;
+
+        app->wait_set_table.put(handle, SharedPointer<CPU::WaitSet>(new CPU::WaitSet(handle)));
+        return handle;
+    }
+
+    auto wait_set_add(void*     sys_call_ctx,
+                      const U64 ID,
+                      const U64 event_type,
+                      const U64 resource,
+                      const U64 user_data) -> Ember::StatusCode {
+        const auto* app_syscall_ctx = static_cast<AppSystemCallContext*>(sys_call_ctx);
+        App::Info*  app             = app_syscall_ctx->app_module->get_active_app();
+        const auto  wait_set        = app->wait_set_table.find(ID);
+        if (!wait_set) return Ember::Status::UNKNOWN_ID;
+
+        // The poll functions keep a reference to the event source, so it lives as long as the entry
+        const Ember::WaitEventType type(event_type);
+        const U16                  k_resource = resource;
+        bool                       added      = false;
+        switch (type) {
+            case Ember::WaitEventType::NODE_READABLE: {
+                const SharedPointer<VFS::Node> node =
+                    app_syscall_ctx->vfs_module->find_node(k_resource);
+                if (!node) return Ember::Status::UNKNOWN_ID;
+                if (!node->has_attribute(Ember::NodeAttribute::FILE))
+                    return Ember::Status::NODE_IS_DIRECTORY;
+                // Files never block -> Poll the node until all data is read or it is closed
+                auto poll = [node](int& result) {
+                    if (node->is_closed()) {
+                        result = Ember::Status::NODE_CLOSED;
+                        return true;
+                    }
+                    return node->has_more();
+                };
+                added = wait_set->add(type, k_resource, user_data, nullptr, poll);
+                break;
+            }
+            case Ember::WaitEventType::STDIN_KEY: {
+                const auto std_in = app->std_in;
+                auto       poll   = [std_in](int& result) {
+                    SILENCE_UNUSED(result)
+                    return std_in->has_input();
+                };
+                added = wait_set->add(type,
+                                      k_resource,
+                                      user_data,
+                                      std_in->get_input_wait_queue(),
+                                      poll);
+                break;
+            }
+            case Ember::WaitEventType::APP_EXIT: {
+                const SharedPointer<App::Info> target =
+                    app_syscall_ctx->app_module->find_app(k_resource);
+                if (!target) return Ember::Status::UNKNOWN_ID;
+                auto poll = [target](int& result) {
+                    result = target->exit_code;
+                    return target->has_exited;
+                };
+                added = wait_set->add(type, k_resource, user_data, &target->exit_wait_queue, poll);
+                break;
+            }
+            case Ember::WaitEventType::MUTEX_UNLOCKED: {
+                const SharedPointer<CPU::Mutex> mutex =
+                    app_syscall_ctx->cpu_module->find_mutex(k_resource);
+                if (!mutex) return Ember::Status::UNKNOWN_ID;
+                auto poll = [mutex](int& result) {
+                    SILENCE_UNUSED(result)
+                    return mutex->get_owner() == nullptr;
+                };
+                added = wait_set->add(type,
+                                      k_resource,
+                                      user_data,
+                                      mutex->get_unlock_wait_queue(),
+                                      poll);
+                break;
+            }
+            default: return Ember::Status::BAD_ARG;
+        }
+        return added ? Ember::Status::OKAY : Ember::Status::BAD_ARG;
+    }
+
+    auto wait_set_remove(void*     sys_call_ctx,
+                         const U64 ID,
+                         const U64 event_type,
+                         const U64 resource) -> Ember::StatusCode {
+        const auto* app_syscall_ctx = static_cast<AppSystemCallContext*>(sys_call_ctx);
+        const auto  wait_set =
+            app_syscall_ctx->app_module->get_active_app()->wait_set_table.find(ID);
+        if (!wait_set) return Ember::Status::UNKNOWN_ID;
+
+        return wait_set->remove(Ember::WaitEventType(event_type), resource)
+                   ? Ember::Status::OKAY
+                   : Ember::Status::UNKNOWN_ID;
+    }
+
+    auto wait_set_wait(void*     sys_call_ctx,
+                       const U64 ID,
+                       const U64 events_out,
+                       const U64 events_out_size,
+                       const U64 timeout_millis) -> Ember::StatusCode {
+        const auto* app_syscall_ctx = static_cast<AppSystemCallContext*>(sys_call_ctx);
+        const auto  wait_set =
+            app_syscall_ctx->app_module->get_active_app()->wait_set_table.find(ID);
+        if (!wait_set) return Ember::Status::UNKNOWN_ID;
+        if (events_out_size == 0) return Ember::Status::BAD_ARG;
+        // Clamp before the buffer size is computed, so a huge event count cannot overflow it
+        const size_t event_limit =
+            min(events_out_size, static_cast<U64>(Ember::WAIT_EVENT_LIMIT));
+        auto* u_events = reinterpret_cast<void*>(events_out);
+        if (!app_syscall_ctx->k_guard->pin_user_buffer(u_events,
+                                                       event_limit * sizeof(Ember::WaitEvent),
+                                                       true))
+            return Ember::Status::BAD_ARG;
+
+        const U64 timeout_nanos = timeout_millis >= Ember::WAIT_FOREVER / MILLI_TO_NANO
+                                      ? Ember::WAIT_FOREVER
+                                      : timeout_millis * MILLI_TO_NANO;
+        Array<Ember::WaitEvent, Ember::WAIT_EVENT_LIMIT> k_events;
+        const int event_count = wait_set->wait(k_events.data(),
+                                               event_limit,
+                                               app_syscall_ctx->cpu_module->get_system_timer(),
+                                               timeout_nanos);
+        if (event_count < 0) return Ember::Status::BAD_ARG;
+        if (event_count == 0) return 0;
+
+        return app_syscall_ctx->k_guard->copy_byte_buffer_kernel_to_user(
+                   reinterpret_cast<void*>(k_events.data()),
+                   u_events,
+                   event_count * sizeof(Ember::WaitEvent))
+                   ? static_cast<Ember::StatusCode>(event_count)
+                   : Ember::Status::BAD_ARG;
+    }
+
+    auto wait_set_free(void* sys_call_ctx, const U64 ID) -> Ember::StatusCode {
+        const auto* app_syscall_ctx = static_cast<AppSystemCallContext*>(sys_call_ctx);
+        App::Info*  app             = app_syscall_ctx->app_module->get_active_app();
+        return app->wait_set_table.remove(ID) ? Ember::Status::OKAY : Ember::Status::UNKNOWN_ID;
+    }
+
+    auto trace_system_calls(void* sys_call_ctx, const U64 app_handle, const U64 enable)
+        -> Ember::StatusCode {
+        const auto* app_syscall_ctx = static_cast<AppSystemCallContext*>(sys_call_ctx);
+        if (!app_syscall_ctx->app_module->find_app(app_handle)) return Ember::Status::UNKNOWN_ID;
+
+        return system_call_trace(app_handle, enable != 0) ? Ember::Status::OKAY
+                                                          : Ember::Status::FAULT;
+    }
+
+    auto read_system_call_trace(void*     sys_call_ctx,
+                                const U64 core_id,
+                                const U64 cursor,
+                                const U64 records_out,
+                                const U64 records_out_size) -> Ember::StatusCode {
+        const auto* app_syscall_ctx = static_cast<AppSystemCallContext*>(sys_call_ctx);
+        if (records_out_size == 0 || core_id > static_cast<U8>(-1)) return Ember::Status::BAD_ARG;
+        // Clamp before the buffer size is computed, so a huge record count cannot overflow it
+        const size_t record_limit =
+            min(records_out_size, static_cast<U64>(Ember::SYSTEM_CALL_TRACE_READ_LIMIT));
+        auto* u_cursor  = reinterpret_cast<void*>(cursor);
+        auto* u_records = reinterpret_cast<void*>(records_out);
+        if (!app_syscall_ctx->k_guard->pin_user_buffer(u_cursor, sizeof(U64), true)
+            || !app_syscall_ctx->k_guard->pin_user_buffer(
+                u_records,
+                record_limit * sizeof(Ember::SystemCallTraceRecord),
+                true))
+            return Ember::Status::BAD_ARG;
+
+        U64 k_cursor = 0;
+        if (!app_syscall_ctx->k_guard->copy_byte_buffer_user_to_kernel(u_cursor,
+                                                                       sizeof(U64),
+                                                                       &k_cursor))
+            return Ember::Status::BAD_ARG;
+        Array<Ember::SystemCallTraceRecord, Ember::SYSTEM_CALL_TRACE_READ_LIMIT> k_records;
+        const int record_count =
+            system_call_trace_read(core_id, k_cursor, k_records.data(), record_limit);
+        if (record_count < 0) return Ember::Status::UNKNOWN_ID;
+
+        if (!app_syscall_ctx->k_guard->copy_byte_buffer_kernel_to_user(&k_cursor,
+                                                                       u_cursor,
+                                                                       sizeof(U64)))
+            return Ember::Status::BAD_ARG;
+        if (record_count == 0) return 0;
+        return app_syscall_ctx->k_guard->copy_byte_buffer_kernel_to_user(
+                   reinterpret_cast<void*>(k_records.data()),
+                   u_records,
+                   record_count * sizeof(Ember::SystemCallTraceRecord))
+                   ? static_cast<Ember::StatusCode>(record_count)
+                   : Ember::Status::BAD_ARG;
+    }
+
+    auto read_system_call_stats(void* sys_call_ctx, const U64 stats_out, const U64 stats_out_size)
+        -> Ember::StatusCode {
+        const auto* app_syscall_ctx = static_cast<AppSystemCallContext*>(sys_call_ctx);
+        if (stats_out_size == 0) return Ember::Status::BAD_ARG;
+        // There are never more statistics than system calls, clamping also keeps the buffer size
+        // from overflowing
+        LinkedList<SystemCallInfo> sys_call_table = system_call_get_table();
+        const size_t stats_limit = min(stats_out_size, static_cast<U64>(sys_call_table.size()));
+        auto*        u_stats     = reinterpret_cast<Ember::SystemCallStats*>(stats_out);
+        if (!app_syscall_ctx->k_guard->pin_user_buffer(u_stats,
+                                                       stats_limit * sizeof(Ember::SystemCallStats),
+                                                       true))
+            return Ember::Status::BAD_ARG;
+
+        U64 stats_count = 0;
+        for (auto& sys_call : sys_call_table) {
+            if (sys_call.latency.count == 0) continue;
+            if (stats_count == stats_limit) break;
+            if (!app_syscall_ctx->k_guard->copy_byte_buffer_kernel_to_user(
+                    &sys_call.latency,
+                    &u_stats[stats_count],
+                    sizeof(Ember::SystemCallStats)))
+                return Ember::Status::BAD_ARG;
+            stats_count++;
+        }
+        return static_cast<Ember::StatusCode>(stats_count);
+    }
+
+    auto read_resource_usage(void* sys_call_ctx, const U64 usage_out, const U64 usage_out_size)
+        -> Ember::StatusCode {
+        const auto* app_syscall_ctx = static_cast<AppSystemCallContext*>(sys_call_ctx);
+        if (usage_out_size == 0) return Ember::Status::BAD_ARG;
+        // There are never more usage records than apps, clamping also keeps the buffer size from
+        // overflowing
+        LinkedList<App::Info*> app_table = app_syscall_ctx->app_module->get_app_table();
+        const size_t usage_limit = min(usage_out_size, static_cast<U64>(app_table.size()));
+        auto*        u_usage     = reinterpret_cast<Ember::AppResourceUsage*>(usage_out);
+        if (!app_syscall_ctx->k_guard->pin_user_buffer(u_usage,
+                                                       usage_limit
+                                                           * sizeof(Ember::AppResourceUsage),
+                                                       true))
+            return Ember::Status::BAD_ARG;
+
+        U64 usage_count = 0;
+        for (auto* app : app_table) {
+            if (usage_count == usage_limit) break;
+            Ember::AppResourceUsage usage = app_syscall_ctx->app_module->get_resource_usage(*app);
+            if (!app_syscall_ctx->k_guard->copy_byte_buffer_kernel_to_user(
+                    &usage,
+                    &u_usage[usage_count],
+                    sizeof(Ember::AppResourceUsage)))
+                return Ember::Status::BAD_ARG;
+            usage_count++;
+        }
+        return static_cast<Ember::StatusCode>(usage_count);
+    }
 } // namespace Rune::SystemCall
@@ -58,6 +58,10 @@ namespace Rune::SystemCall {
                               Ember::App(Ember::App::READ_STDIN).to_string(),
                               &read_stdin,
                               &APP_SYSCALL_CTX));
+        defs.add_back(define3(Ember::App::READ_STDIN_KEYS,
+                              Ember::App(Ember::App::READ_STDIN_KEYS).to_string(),
+                              &read_stdin_keys,
+                              &APP_SYSCALL_CTX));
         defs.add_back(define2(Ember::App::WRITE_STDOUT,
                               Ember::App(Ember::App::WRITE_STDOUT).to_string(),
                               &write_stdout,
@@ -90,6 +94,46 @@ namespace Rune::SystemCall {
                               Ember::App(Ember::App::CHANGE_DIRECTORY).to_string(),
                               &app_change_directory,
                               &APP_SYSCALL_CTX));
+        defs.add_back(define0(Ember::App::WAIT_SET_CREATE,
+                              Ember::App(Ember::App::WAIT_SET_CREATE).to_string(),
+                              &wait_set_create,
+                              &APP_SYSCALL_CTX));
+        defs.add_back(define4(Ember::App::WAIT_SET_ADD,
+                              Ember::App(Ember::App::WAIT_SET_ADD).to_string(),
+                              &wait_set_add,
+                              &APP_SYSCALL_CTX));
+        defs.add_back(define3(Ember::App::WAIT_SET_REMOVE,
+                              Ember::App(Ember::App::WAIT_SET_REMOVE).to_string(),
+                              &wait_set_remove,
+                              &APP_SYSCALL_CTX));
+        defs.add_back(define4(Ember::App::WAIT_SET_WAIT,
+                              Ember::App(Ember::App::WAIT_SET_WAIT).to_string(),
+                              &wait_set_wait,
+                              &APP_SYSCALL_CTX));
+        defs.add_back(define1(Ember::App::WAIT_SET_FREE,
+                              Ember::App(Ember::App::WAIT_SET_FREE).to_string(),
+                              &wait_set_free,
+                              &APP_SYSCALL_CTX));
+        defs.add_back(define2(Ember::App::TRACE_SYSTEM_CALLS,
+                              Ember::App(Ember::App::TRACE_SYSTEM_CALLS).to_string(),
+                              &trace_system_calls,
+                              &APP_SYSCALL_CTX));
+        defs.add_back(define4(Ember::App::READ_SYSTEM_CALL_TRACE,
+                              Ember::App(Ember::App::READ_SYSTEM_CALL_TRACE).to_string(),
+                              &read_system_call_trace,
+                              &APP_SYSCALL_CTX));
+        defs.add_back(define2(Ember::App::READ_SYSTEM_CALL_STATS,
+                              Ember::App(Ember::App::READ_SYSTEM_CALL_STATS).to_string(),
+                              &read_system_call_stats,
+                              &APP_SYSCALL_CTX));
+        defs.add_back(define2(Ember::App::CLONE,
+                              Ember::App(Ember::App::CLONE).to_string(),
+                              &app_clone,
+                              &APP_SYSCALL_CTX));
+        defs.add_back(define2(Ember::App::READ_RESOURCE_USAGE,
+                              Ember::App(Ember::App::READ_RESOURCE_USAGE).to_string(),
+                              &read_resource_usage,
+                              &APP_SYSCALL_CTX));
 
         return {.name = "App", .system_call_definitions = defs};
     }
@@ -160,6 +204,14 @@ namespace Rune::SystemCall {
                               Ember::VFS(Ember::VFS::DIRECTORY_STREAM_CLOSE).to_string(),
                               &vfs_directory_stream_close,
                               &VFS_SYSCALL_CTX));
+        defs.add_back(define1(Ember::VFS::IO_RING_SETUP,
+                              Ember::VFS(Ember::VFS::IO_RING_SETUP).to_string(),
+                              &vfs_io_ring_setup,
+                              &VFS_SYSCALL_CTX));
+        defs.add_back(define1(Ember::VFS::IO_RING_ENTER,
+                              Ember::VFS(Ember::VFS::IO_RING_ENTER).to_string(),
+                              &vfs_io_ring_enter,
+                              &VFS_SYSCALL_CTX));
         return {.name = "VFS", .system_call_definitions = defs};
     }
 
@@ -237,6 +289,30 @@ namespace Rune::SystemCall {
                     Ember::Threading(Ember::Threading::THREAD_CONTROL_BLOCK_SET).to_string(),
                     &set_thread_control_block,
                     &T_SYSCALL_CTX));
+        defs.add_back(define3(Ember::Threading::FUTEX_WAIT,
+                              Ember::Threading(Ember::Threading::FUTEX_WAIT).to_string(),
+                              &futex_wait,
+                              &T_SYSCALL_CTX));
+        defs.add_back(define2(Ember::Threading::FUTEX_WAKE,
+                              Ember::Threading(Ember::Threading::FUTEX_WAKE).to_string(),
+                              &futex_wake,
+                              &T_SYSCALL_CTX));
+        defs.add_back(define2(Ember::Threading::THREAD_CREATE,
+                              Ember::Threading(Ember::Threading::THREAD_CREATE).to_string(),
+                              &create_thread,
+                              &T_SYSCALL_CTX));
+        defs.add_back(define1(Ember::Threading::THREAD_JOIN,
+                              Ember::Threading(Ember::Threading::THREAD_JOIN).to_string(),
+                              &join_thread,
+                              &T_SYSCALL_CTX));
+        defs.add_back(define1(Ember::Threading::THREAD_EXIT,
+                              Ember::Threading(Ember::Threading::THREAD_EXIT).to_string(),
+                              &exit_thread,
+                              &T_SYSCALL_CTX));
+        defs.add_back(define0(Ember::Threading::THREAD_YIELD,
+                              Ember::Threading(Ember::Threading::THREAD_YIELD).to_string(),
+                              &yield_thread,
+                              &T_SYSCALL_CTX));
         return {.name = "Threading", .system_call_definitions = defs};
     }
 
@@ -16,6 +16,15 @@
 
 #include <SystemCall/KernelGuardian.h>
 
+#include <KRE/Math.h>
+
+#include <Memory/Paging.h>
+
+#include <CPU/Threading/CriticalSection.h>
+#include <CPU/Threading/Scheduler.h>
+
+#include <App/App.h>
+
 namespace Rune::SystemCall {
     KernelGuardian::KernelGuardian() = default;
 
@@ -23,9 +32,58 @@ namespace Rune::SystemCall {
         _kernel_memory_start = kernel_memory_start;
     }
 
+    void KernelGuardian::set_virtual_memory_manager(Memory::VirtualMemoryManager* vmm) {
+        _vmm = vmm;
+    }
+
     auto KernelGuardian::verify_user_buffer(void* user_buf, size_t user_buf_size) const -> bool {
-        return (user_buf != nullptr)
-               && memory_pointer_to_addr(user_buf) + user_buf_size < _kernel_memory_start;
+        // Compare against the space left below kernel memory, adding the size could wrap around
+        const VirtualAddr buf_start = memory_pointer_to_addr(user_buf);
+        return (user_buf != nullptr) && buf_start < _kernel_memory_start
+               && user_buf_size < _kernel_memory_start - buf_start;
+    }
+
+    auto KernelGuardian::pin_user_buffer(void*        user_buf,
+                                         const size_t user_buf_size,
+                                         const bool   write_access) const -> bool {
+        if (!verify_user_buffer(user_buf, user_buf_size)) return false;
+
+        const Memory::PageTable base_pt   = Memory::get_base_page_table();
+        const MemorySize        page_size = Memory::get_page_size();
+        const VirtualAddr       buf_start = memory_pointer_to_addr(user_buf);
+        const VirtualAddr       buf_end   = buf_start + user_buf_size;
+
+        // Other threads of the app must not free the buffer while the system call uses it -> Pin
+        // it before the pages are checked, so it cannot be freed after the check
+        CPU::Thread* running_thread = CPU::g_scheduler.get_running_thread().get();
+        {
+            CPU::CriticalSection<CPU::InterruptSaveLock> _(running_thread->app->user_memory_lock);
+            if (running_thread->pinned_user_memory_start
+                == running_thread->pinned_user_memory_end) {
+                running_thread->pinned_user_memory_start = buf_start;
+                running_thread->pinned_user_memory_end   = buf_end;
+            } else {
+                running_thread->pinned_user_memory_start =
+                    min(running_thread->pinned_user_memory_start, buf_start);
+                running_thread->pinned_user_memory_end =
+                    max(running_thread->pinned_user_memory_end, buf_end);
+            }
+        }
+
+        // Check every page of the buffer, a page fault in the middle of a system call would crash
+        // the kernel
+        for (VirtualAddr page = buf_start - (buf_start % page_size); page < buf_end;
+             page             += page_size) {
+            const Memory::PageTableAccess pta = Memory::find_page(base_pt, page);
+            if (pta.status != Memory::PageTableAccessStatus::OKAY) return false;
+
+            const Memory::PageTableEntry& pte = pta.path[0];
+            if (!pte.is_user_mode_access_allowed()) return false;
+            if (write_access && !pte.is_write_allowed()
+                && (!pte.is_copy_on_write() || !_vmm->resolve_copy_on_write(base_pt, page)))
+                return false;
+        }
+        return true;
     }
 
     auto KernelGuardian::copy_byte_buffer_user_to_kernel(void*  user_buf,
@@ -22,6 +22,8 @@
 #include <Ember/Ember.h>
 #include <Ember/MemoryBits.h>
 
+#include <CPU/Threading/CriticalSection.h>
+
 namespace Rune::SystemCall {
     auto memory_get_page_size(const void* sys_call_ctx) -> Ember::StatusCode {
         SILENCE_UNUSED(sys_call_ctx)
@@ -112,6 +114,7 @@ namespace Rune::SystemCall {
         // Extend the heap limit if it got bigger
         // maybe_new_heap_limit = kv_addr + (num_pages * page_size)
         app->heap_limit = max(kv_addr + (num_pages * page_size), app->heap_limit);
+        app->usage.add_heap_pages(num_pages);
 
         return static_cast<Ember::StatusCode>(kv_addr);
     }
@@ -132,8 +135,40 @@ namespace Rune::SystemCall {
         if (!mem_ctx->k_guard->verify_user_buffer(reinterpret_cast<void*>(kv_addr),
                                                   num_pages * page_size))
             return Ember::Status::BAD_ARG;
-
-        if (!vmm->free(kv_addr, num_pages)) return Ember::Status::FAULT;
+        // Only the heap can be freed, thread stacks and the kernel info area are above it. The
+        // kernel clock page frame is shared with all apps and must never be freed
+        if (kv_addr >= app->heap_limit || num_pages > (app->heap_limit - kv_addr) / page_size)
+            return Ember::Status::BAD_ARG;
+        if (app->kernel_info != nullptr) {
+            const VirtualAddr kernel_info_begin =
+                memory_pointer_to_addr(app->kernel_info->clock) - page_size;
+            if (kernel_info_begin < kv_addr + (num_pages * page_size)
+                && kv_addr < kernel_info_begin + (2 * page_size))
+                return Ember::Status::BAD_ARG;
+        }
+        // The page frames of shared segments are owned by the segment cache and still mapped by
+        // other apps
+        for (const auto& segment : app->shared_segments) {
+            const VirtualAddr segment_end =
+                segment->virtual_start + (segment->get_page_count() * page_size);
+            if (segment->virtual_start < kv_addr + (num_pages * page_size)
+                && kv_addr < segment_end)
+                return Ember::Status::BAD_ARG;
+        }
+        {
+            // Another thread of the app is in a system call that uses the memory, the lock keeps
+            // it from pinning the memory between the check and the free
+            CPU::CriticalSection<CPU::InterruptSaveLock> _(app->user_memory_lock);
+            if (mem_ctx->app_module->is_user_memory_pinned(kv_addr, num_pages * page_size))
+                return Ember::Status::FAULT;
+
+            // Free page by page, so the heap usage stays exact when only some pages are freed
+            U64 freed_pages = 0;
+            for (U64 i = 0; i < num_pages; i++)
+                if (vmm->free(kv_addr + (i * page_size))) freed_pages++;
+            app->usage.remove_heap_pages(freed_pages);
+            if (freed_pages < num_pages) return Ember::Status::FAULT;
+        }
 
         if (const VirtualAddr mem_region_end = kv_addr + (num_pages * page_size);
             mem_region_end == app->heap_limit)
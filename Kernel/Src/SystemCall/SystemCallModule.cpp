@@ -42,6 +42,7 @@ namespace Rune::SystemCall {
         auto  user_space_end = mem_module->get_virtual_memory_manager()->get_user_space_end();
         LOGGER->debug("Kernel memory start: {:0=#16x}", user_space_end);
         _k_guard.set_kernel_memory_start(user_space_end);
+        _k_guard.set_virtual_memory_manager(mem_module->get_virtual_memory_manager());
         system_call_init(&_k_guard);
 
         LinkedList<Bundle> native_sys_calls = system_call_get_native_bundles(&_k_guard);
@@ -70,12 +71,15 @@ namespace Rune::SystemCall {
     }
 
     void SystemCallModule::dump_system_call_table(const SharedPointer<TextStream>& stream) const {
-        TableFormatter<SystemCallInfo, 2>::make_table(
-            [](const SystemCallInfo& sci) -> Array<String, 2> {
+        TableFormatter<SystemCallInfo, 4>::make_table(
+            [](const SystemCallInfo& sci) -> Array<String, 4> {
+                const U64 traced = sci.latency.count;
                 return {String::format("{}-{}", sci.handle, sci.name),
-                        String::format("{}", sci.requested)};
+                        String::format("{}", sci.requested),
+                        String::format("{}", traced),
+                        String::format("{}", traced > 0 ? sci.latency.total_cycles / traced : 0)};
             })
-            .with_headers({"ID-Name", "Requested"})
+            .with_headers({"ID-Name", "Requested", "Traced", "Avg Cycles"})
             .with_data(system_call_get_table())
             .print(stream);
     }
@@ -16,9 +16,21 @@
 
 #include <SystemCall/ThreadingBundle.h>
 
+#include <Ember/AppBits.h>
 #include <Ember/Ember.h>
 
+#include <CPU/Threading/Futex.h>
+
 namespace Rune::SystemCall {
+    constexpr U64 MILLI_TO_NANO = 1000000;
+
+    namespace {
+        auto validate_futex(const ThreadingSystemCallContext* t_ctx, volatile int* futex) -> bool {
+            return futex != nullptr && memory_pointer_to_addr(futex) % alignof(int) == 0
+                   && t_ctx->k_guard->pin_user_buffer(const_cast<int*>(futex), sizeof(int), false);
+        }
+    } // namespace
+
     auto mutex_create(void* sys_call_ctx, const U64 mutex_name) -> Ember::StatusCode {
         const auto* t_ctx = static_cast<ThreadingSystemCallContext*>(sys_call_ctx);
 
@@ -80,4 +92,68 @@ namespace Rune::SystemCall {
         CPU::current_core()->update_thread_local_storage(tcb_ptr);
         return Ember::Status::OKAY;
     }
+
+    auto create_thread(void* sys_call_ctx, const U64 entry, const U64 arg) -> Ember::StatusCode {
+        const auto* t_ctx   = static_cast<ThreadingSystemCallContext*>(sys_call_ctx);
+        auto*       u_entry = reinterpret_cast<void*>(entry);
+        if (!t_ctx->k_guard->verify_user_buffer(u_entry, 1)) return Ember::Status::BAD_ARG;
+
+        const U16 t_handle =
+            t_ctx->app_module->start_thread(reinterpret_cast<CPU::ThreadMain>(entry),
+                                            reinterpret_cast<void*>(arg));
+        return t_handle == 0 ? Ember::Status(Ember::Status::FAULT).to_value() : t_handle;
+    }
+
+    auto join_thread(void* sys_call_ctx, const U64 ID) -> Ember::StatusCode {
+        const auto* t_ctx = static_cast<ThreadingSystemCallContext*>(sys_call_ctx);
+        if (ID == 0 || ID == t_ctx->cpu_module->get_scheduler()->get_running_thread()->get_handle())
+            return Ember::Status::BAD_ARG;
+
+        return t_ctx->app_module->join_thread(ID) ? Ember::Status::OKAY
+                                                  : Ember::Status::UNKNOWN_ID;
+    }
+
+    auto exit_thread(void* sys_call_ctx, const U64 exit_code) -> Ember::StatusCode {
+        const auto* t_ctx = static_cast<ThreadingSystemCallContext*>(sys_call_ctx);
+        t_ctx->app_module->exit_running_thread(static_cast<int>(exit_code));
+        return Ember::Status::OKAY;
+    }
+
+    auto yield_thread(void* sys_call_ctx) -> Ember::StatusCode {
+        const auto* t_ctx = static_cast<ThreadingSystemCallContext*>(sys_call_ctx);
+        t_ctx->cpu_module->get_scheduler()->preempt_running_thread();
+        return Ember::Status::OKAY;
+    }
+
+    auto futex_wait(void*     sys_call_ctx,
+                    const U64 futex,
+                    const U64 expected,
+                    const U64 timeout_millis) -> Ember::StatusCode {
+        const auto* t_ctx   = static_cast<ThreadingSystemCallContext*>(sys_call_ctx);
+        auto*       u_futex = memory_addr_to_pointer<volatile int>(futex);
+        if (!validate_futex(t_ctx, u_futex)) return Ember::Status::BAD_ARG;
+
+        const U64 timeout_nanos = timeout_millis >= Ember::WAIT_FOREVER / MILLI_TO_NANO
+                                      ? Ember::WAIT_FOREVER
+                                      : timeout_millis * MILLI_TO_NANO;
+        switch (CPU::g_futex_table.wait(u_futex,
+                                        static_cast<int>(expected),
+                                        t_ctx->cpu_module->get_system_timer(),
+                                        timeout_nanos)) {
+            case CPU::FutexWaitStatus::WOKEN:         return Ember::Status::OKAY;
+            case CPU::FutexWaitStatus::VALUE_CHANGED: return Ember::Status::FUTEX_VALUE_CHANGED;
+            case CPU::FutexWaitStatus::TIMED_OUT:     return Ember::Status::FUTEX_TIMED_OUT;
+            default:                                  return Ember::Status::FAULT;
+        }
+    }
+
+    auto futex_wake(void* sys_call_ctx, const U64 futex, const U64 count) -> Ember::StatusCode {
+        const auto* t_ctx   = static_cast<ThreadingSystemCallContext*>(sys_call_ctx);
+        auto*       u_futex = memory_addr_to_pointer<volatile int>(futex);
+        if (!validate_futex(t_ctx, u_futex)) return Ember::Status::BAD_ARG;
+
+        const auto running_thread = t_ctx->cpu_module->get_scheduler()->get_running_thread();
+        return static_cast<Ember::StatusCode>(
+            CPU::g_futex_table.wake(running_thread->base_page_table_address, futex, count));
+    }
 } // namespace Rune::SystemCall
@@ -205,20 +205,18 @@ namespace Rune::SystemCall {
         if (!node->has_attribute(Ember::NodeAttribute::FILE))
             return Ember::Status::NODE_IS_DIRECTORY;
 
+        // The file content is read directly into the user buffer
         auto* const  u_buf      = reinterpret_cast<void*>(buf);
         const size_t u_buf_size = buf_size;
-        if (!vfs_ctx->k_guard->verify_user_buffer(u_buf, u_buf_size)) return Ember::Status::BAD_ARG;
+        if (!vfs_ctx->k_guard->pin_user_buffer(u_buf, u_buf_size, true))
+            return Ember::Status::BAD_ARG;
 
-        U8 k_buf[u_buf_size]; // NOLINT Is Kernel ABI
-        memset(k_buf, 0, u_buf_size);
-        auto [status, byte_count] = node->read(k_buf, u_buf_size);
+        auto [status, byte_count] = node->read(u_buf, u_buf_size);
         if (status == VFS::NodeIOStatus::NOT_SUPPORTED) return Ember::Status::ACCESS_DENIED;
         if (status == VFS::NodeIOStatus::CLOSED) return Ember::Status::NODE_CLOSED;
         if (status == VFS::NodeIOStatus::DEV_ERROR) return Ember::Status::IO_ERROR;
 
-        if (!vfs_ctx->k_guard->copy_byte_buffer_kernel_to_user(k_buf, u_buf, u_buf_size))
-            return -Ember::Status::IO_ERROR;
-
+        vfs_ctx->app_module->get_active_app()->usage.bytes_read += byte_count;
         return static_cast<Ember::StatusCode>(byte_count);
     }
 
@@ -234,15 +232,16 @@ namespace Rune::SystemCall {
         if (!node->has_attribute(Ember::NodeAttribute::FILE))
             return Ember::Status::NODE_IS_DIRECTORY;
 
+        // The user buffer is written directly to the file
         auto* const  u_buf      = reinterpret_cast<void*>(buf);
         const size_t u_buf_size = buf_size;
-        U8           k_buf[u_buf_size]; // NOLINT Is Kernel ABI
-        memset(k_buf, 0, u_buf_size);
-        if (!vfs_ctx->k_guard->copy_byte_buffer_user_to_kernel(u_buf, u_buf_size, k_buf))
+        if (!vfs_ctx->k_guard->pin_user_buffer(u_buf, u_buf_size, false))
             return Ember::Status::BAD_ARG;
 
-        switch (auto [status, byte_count] = node->write(k_buf, u_buf_size); status) {
-            case VFS::NodeIOStatus::OKAY:          return static_cast<Ember::StatusCode>(byte_count);
+        switch (auto [status, byte_count] = node->write(u_buf, u_buf_size); status) {
+            case VFS::NodeIOStatus::OKAY:
+                vfs_ctx->app_module->get_active_app()->usage.bytes_written += byte_count;
+                return static_cast<Ember::StatusCode>(byte_count);
             case VFS::NodeIOStatus::NOT_SUPPORTED: return Ember::Status::NODE_IS_DIRECTORY;
             case VFS::NodeIOStatus::NOT_ALLOWED:   return Ember::Status::ACCESS_DENIED;
             case VFS::NodeIOStatus::CLOSED:        return Ember::Status::NODE_CLOSED;
@@ -350,4 +349,91 @@ namespace Rune::SystemCall {
         dir_stream->close();
         return Ember::Status::OKAY;
     }
+
+    /**
+     * @brief Check that the queues of the IO ring can be accessed in place by the kernel.
+     * @param vfs_ctx
+     * @param ring    Kernel copy of the IO ring.
+     * @return True: The IO ring is valid, False: It is not.
+     */
+    auto pin_io_ring(const VFSSystemCallContext* vfs_ctx, const Ember::IORing& ring) -> bool {
+        if (ring.entry_count == 0 || ring.entry_count > Ember::IO_RING_ENTRY_LIMIT
+            || (ring.entry_count & (ring.entry_count - 1)) != 0)
+            return false;
+        return vfs_ctx->k_guard->pin_user_buffer(ring.submissions,
+                                                 ring.entry_count * sizeof(Ember::IORingSubmission),
+                                                 false)
+               && vfs_ctx->k_guard->pin_user_buffer(ring.completions,
+                                                    ring.entry_count
+                                                        * sizeof(Ember::IORingCompletion),
+                                                    true);
+    }
+
+    /**
+     * @brief Run the VFS system call requested by an IO ring submission.
+     * @param sys_call_ctx
+     * @param submission
+     * @return The status code of the VFS system call.
+     */
+    auto io_ring_execute(void* sys_call_ctx, const Ember::IORingSubmission& submission)
+        -> Ember::StatusCode {
+        switch (submission.op) {
+            case Ember::IORingOp::OPEN:
+                return vfs_open(sys_call_ctx, submission.arg1, submission.arg2);
+            case Ember::IORingOp::CLOSE: return vfs_close(sys_call_ctx, submission.arg1);
+            case Ember::IORingOp::READ:
+                return vfs_read(sys_call_ctx, submission.arg1, submission.arg2, submission.arg3);
+            case Ember::IORingOp::WRITE:
+                return vfs_write(sys_call_ctx, submission.arg1, submission.arg2, submission.arg3);
+            case Ember::IORingOp::SEEK:
+                return vfs_seek(sys_call_ctx, submission.arg1, submission.arg2, submission.arg3);
+            case Ember::IORingOp::GET_NODE_INFO:
+                return vfs_get_node_info(sys_call_ctx, submission.arg1, submission.arg2);
+            case Ember::IORingOp::DIRECTORY_STREAM_NEXT:
+                return vfs_directory_stream_next(sys_call_ctx, submission.arg1, submission.arg2);
+            default: return Ember::Status::BAD_ARG;
+        }
+    }
+
+    auto vfs_io_ring_setup(void* sys_call_ctx, const U64 ring) -> Ember::StatusCode {
+        const auto* vfs_ctx = static_cast<VFSSystemCallContext*>(sys_call_ctx);
+        auto* const u_ring  = reinterpret_cast<Ember::IORing*>(ring);
+        if (!vfs_ctx->k_guard->pin_user_buffer(u_ring, sizeof(Ember::IORing), true))
+            return Ember::Status::BAD_ARG;
+
+        if (!pin_io_ring(vfs_ctx, *u_ring)) return Ember::Status::BAD_ARG;
+        vfs_ctx->app_module->get_active_app()->io_ring = ring;
+        return Ember::Status::OKAY;
+    }
+
+    auto vfs_io_ring_enter(void* sys_call_ctx, const U64 to_submit) -> Ember::StatusCode {
+        const auto* vfs_ctx = static_cast<VFSSystemCallContext*>(sys_call_ctx);
+        const U64   ring    = vfs_ctx->app_module->get_active_app()->io_ring;
+        if (ring == 0) return Ember::Status::BAD_ARG;
+
+        // The app could have freed the ring memory since it was registered -> Check it again and
+        // work on a kernel copy of the ring, so the queue pointers cannot change while the
+        // submissions are processed
+        auto* const u_ring = reinterpret_cast<Ember::IORing*>(ring);
+        if (!vfs_ctx->k_guard->pin_user_buffer(u_ring, sizeof(Ember::IORing), true))
+            return Ember::Status::BAD_ARG;
+        Ember::IORing k_ring = *u_ring;
+        if (!pin_io_ring(vfs_ctx, k_ring)) return Ember::Status::BAD_ARG;
+
+        const U32 mask      = k_ring.entry_count - 1;
+        U64       processed = 0;
+        while (processed < to_submit && k_ring.sq_head != k_ring.sq_tail
+               && k_ring.cq_tail - k_ring.cq_head < k_ring.entry_count) {
+            const Ember::IORingSubmission submission = k_ring.submissions[k_ring.sq_head & mask];
+            k_ring.completions[k_ring.cq_tail & mask] = {
+                .user_data = submission.user_data,
+                .status    = io_ring_execute(sys_call_ctx, submission)};
+            k_ring.sq_head++;
+            k_ring.cq_tail++;
+            processed++;
+        }
+        u_ring->sq_head = k_ring.sq_head;
+        u_ring->cq_tail = k_ring.cq_tail;
+        return static_cast<Ember::StatusCode>(processed);
+    }
 } // namespace Rune::SystemCall
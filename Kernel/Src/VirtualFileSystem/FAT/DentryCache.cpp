@@ -0,0 +1,169 @@
+/*
+ *  Copyright 2025 Ewogijk
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <VirtualFileSystem/FAT/DentryCache.h>
+
+#include <KRE/BitsAndBytes.h>
+
+namespace Rune::VFS {
+    DEFINE_ENUM(DentryLookupResult, DENTRY_LOOKUP_RESULTS, 0x0)
+
+    auto DentryCache::make_key(U32 parent_cluster, const String& name) -> U64 {
+        return static_cast<U64>(parent_cluster) << SHIFT_32
+               | static_cast<U32>(Hash<String>{}(name));
+    }
+
+    void DentryCache::lru_unlink(U32 idx) {
+        Dentry& dentry = _dentries[idx];
+        if (dentry.lru_prev != NONE)
+            _dentries[dentry.lru_prev].lru_next = dentry.lru_next;
+        else
+            _lru_head = dentry.lru_next;
+        if (dentry.lru_next != NONE)
+            _dentries[dentry.lru_next].lru_prev = dentry.lru_prev;
+        else
+            _lru_tail = dentry.lru_prev;
+        dentry.lru_prev = NONE;
+        dentry.lru_next = NONE;
+    }
+
+    void DentryCache::lru_push_front(U32 idx) {
+        Dentry& dentry  = _dentries[idx];
+        dentry.lru_prev = NONE;
+        dentry.lru_next = _lru_head;
+        if (_lru_head != NONE) _dentries[_lru_head].lru_prev = idx;
+        _lru_head = idx;
+        if (_lru_tail == NONE) _lru_tail = idx;
+    }
+
+    void DentryCache::remove(U32 idx) {
+        Dentry& dentry = _dentries[idx];
+        _index.remove(make_key(dentry.parent_cluster, dentry.name));
+        lru_unlink(idx);
+        dentry.used     = false;
+        dentry.name     = "";
+        dentry.entry    = {};
+        dentry.lru_next = _free_head;
+        _free_head      = idx;
+        _size--;
+    }
+
+    auto DentryCache::acquire(U32 parent_cluster, const String& name) -> Dentry& {
+        U64  key = make_key(parent_cluster, name);
+        auto it  = _index.find(key);
+        if (it != _index.end()) {
+            // Reuse the dentry of the name, or of another name with the same hash
+            U32 idx = *it->value;
+            lru_unlink(idx);
+            lru_push_front(idx);
+            Dentry& dentry        = _dentries[idx];
+            dentry.parent_cluster = parent_cluster;
+            dentry.name           = name;
+            return dentry;
+        }
+
+        if (_free_head == NONE) remove(_lru_tail); // The cache is full -> Evict the LRU dentry
+        U32 idx    = _free_head;
+        _free_head = _dentries[idx].lru_next;
+        _size++;
+
+        Dentry& dentry        = _dentries[idx];
+        dentry.parent_cluster = parent_cluster;
+        dentry.name           = name;
+        dentry.used           = true;
+        lru_push_front(idx);
+        _index.put(key, idx);
+        return dentry;
+    }
+
+    DentryCache::DentryCache()
+        : _dentries(new Dentry[CAPACITY]),
+          _lru_head(NONE),
+          _lru_tail(NONE),
+          _free_head(0),
+          _size(0) {
+        for (U32 i = 0; i < CAPACITY; i++)
+            _dentries[i].lru_next = i + 1 < CAPACITY ? i + 1 : NONE;
+    }
+
+    DentryCache::~DentryCache() { delete[] _dentries; }
+
+    auto DentryCache::size() const -> U32 { return _size; }
+
+    auto DentryCache::lookup(U32 parent_cluster, const String& name, LocationAwareFileEntry& out)
+        -> DentryLookupResult {
+        auto it = _index.find(make_key(parent_cluster, name));
+        if (it == _index.end()) return DentryLookupResult::MISS;
+
+        U32     idx    = *it->value;
+        Dentry& dentry = _dentries[idx];
+        if (dentry.parent_cluster != parent_cluster || dentry.name != name)
+            return DentryLookupResult::MISS; // Hash collision
+
+        lru_unlink(idx);
+        lru_push_front(idx);
+        if (dentry.negative) return DentryLookupResult::NEGATIVE_HIT;
+        out = dentry.entry;
+        return DentryLookupResult::HIT;
+    }
+
+    void DentryCache::insert(U32                           parent_cluster,
+                             const String&                 name,
+                             const LocationAwareFileEntry& entry) {
+        Dentry& dentry  = acquire(parent_cluster, name);
+        dentry.negative = false;
+        dentry.entry    = entry;
+    }
+
+    void DentryCache::insert_negative(U32 parent_cluster, const String& name) {
+        Dentry& dentry  = acquire(parent_cluster, name);
+        dentry.negative = true;
+        dentry.entry    = {};
+    }
+
+    void DentryCache::update(const LocationAwareFileEntry& entry) {
+        bool deleted = entry.file.short_name.as_array[0] == FileEntry::MARK_EMPTY_MIDDLE;
+        for (U32 i = 0; i < CAPACITY; i++) {
+            Dentry& dentry = _dentries[i];
+            if (!dentry.used || dentry.negative
+                || dentry.entry.location.cluster != entry.location.cluster
+                || dentry.entry.location.entry_idx != entry.location.entry_idx)
+                continue;
+
+            if (deleted) {
+                remove(i);
+            } else {
+                // Keep the cached file name, LFN entries are not passed with the file entry
+                dentry.entry.file = entry.file;
+            }
+        }
+    }
+
+    void DentryCache::invalidate(U32 parent_cluster, const String& name) {
+        auto it = _index.find(make_key(parent_cluster, name));
+        if (it != _index.end()) remove(*it->value);
+    }
+
+    void DentryCache::invalidate_directory(U32 dir_cluster) {
+        for (U32 i = 0; i < CAPACITY; i++)
+            if (_dentries[i].used && _dentries[i].parent_cluster == dir_cluster) remove(i);
+    }
+
+    void DentryCache::clear() {
+        for (U32 i = 0; i < CAPACITY; i++)
+            if (_dentries[i].used) remove(i);
+    }
+} // namespace Rune::VFS
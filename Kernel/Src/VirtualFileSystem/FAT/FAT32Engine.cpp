@@ -84,6 +84,10 @@ namespace Rune::VFS {
         return (reinterpret_cast<BootRecord32*>(bpb))->EBPB.backup_bs_sector;
     }
 
+    auto FAT32Engine::get_fs_info_sector(BIOSParameterBlock* bpb) -> U16 {
+        return (reinterpret_cast<BootRecord32*>(bpb))->EBPB.fs_info;
+    }
+
     auto FAT32Engine::get_root_directory_cluster(BIOSParameterBlock* bpb) -> U32 {
         return (reinterpret_cast<BootRecord32*>(bpb))->EBPB.root_cluster;
     }
@@ -0,0 +1,355 @@
+/*
+ *  Copyright 2025 Ewogijk
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <VirtualFileSystem/FAT/FATCache.h>
+
+#include <KRE/BitsAndBytes.h>
+#include <KRE/Math.h>
+#include <KRE/System/System.h>
+
+#include <Device/DeviceModule.h>
+#include <Device/MassStorage/MassStorage.h>
+
+namespace Rune::VFS {
+
+    auto fc_mass_storage_device_transfer(Device::Handle                       dev_handle,
+                                         Device::MassStorageDeviceRequestType type,
+                                         void*                                buf,
+                                         size_t                               buf_size,
+                                         U32                                  lba) -> size_t {
+        auto* dm = System::instance().get_module<Device::DeviceModule>(ModuleSelector::DEVICE);
+        Device::MassStorageDeviceRequest msd_req{.m_type        = type,
+                                                 .m_lba         = lba,
+                                                 .m_buffer      = buf,
+                                                 .m_buffer_size = buf_size};
+        size_t                           bytes_transferred = 0;
+        Device::IORequest                io_req{
+            .m_in_buffer  = &msd_req,
+            .m_out_buffer = &bytes_transferred,
+        };
+        return dm->control_device(dev_handle, io_req).get() == Device::IORequestStatus::HANDLED
+                   ? bytes_transferred
+                   : 0;
+    }
+
+    // ========================================================================================== //
+    // Private
+    // ========================================================================================== //
+
+    auto FATCache::window_sector_count(U32 window_idx) const -> U32 {
+        U32 first_sector = window_idx * _sectors_per_window;
+        return min(_sectors_per_window, _fat_size - first_sector);
+    }
+
+    auto FATCache::is_free(U32 cluster) const -> bool {
+        return bit_check(_free_map[cluster / 64], cluster % 64);
+    }
+
+    void FATCache::mark_free(U32 cluster, bool free) {
+        if (is_free(cluster) == free) return;
+
+        U64& word = _free_map[cluster / 64];
+        word      = free ? bit_set(word, cluster % 64) : bit_clear(word, cluster % 64);
+        if (free)
+            _free_count++;
+        else
+            _free_count--;
+        _fs_info_dirty = true;
+    }
+
+    auto FATCache::find_free(U32 start, U32 end) const -> U32 {
+        U32 cluster = start;
+        while (cluster < end) {
+            // Mask out the clusters before the start in the first word
+            U64 word = _free_map[cluster / 64] & (~0ULL << (cluster % 64));
+            if (word != 0) {
+                U32 free_cluster = (cluster & ~63u) + __builtin_ctzll(word);
+                return free_cluster < end ? free_cluster : end;
+            }
+            cluster = (cluster & ~63u) + 64;
+        }
+        return end;
+    }
+
+    auto FATCache::load_fs_info() -> bool {
+        if (_fs_info_sector == 0) return true;
+
+        _fs_info_buf = new U8[_bpb->bytes_per_sector];
+        if (fc_mass_storage_device_transfer(_mass_storage_dev_handle,
+                                            Device::MassStorageDeviceRequestType::READ,
+                                            _fs_info_buf,
+                                            _bpb->bytes_per_sector,
+                                            _fs_info_sector)
+            < _bpb->bytes_per_sector)
+            return false;
+
+        auto* fs_info = reinterpret_cast<FileSystemInfo*>(_fs_info_buf);
+        if (fs_info->lead_signature != FileSystemInfo::LEAD_SIGNATURE
+            || fs_info->struc_signature != FileSystemInfo::STRUC_SIGNATURE
+            || fs_info->trail_signature != FileSystemInfo::TRAIL_SIGNATURE) {
+            // Not a valid FSInfo sector -> Never write it
+            delete[] _fs_info_buf;
+            _fs_info_buf    = nullptr;
+            _fs_info_sector = 0;
+            return true;
+        }
+
+        // The free count is always recomputed from the FAT, only the hint is taken over
+        if (fs_info->next_free >= 2 && fs_info->next_free < _cluster_count)
+            _next_free = fs_info->next_free;
+        _fs_info_dirty = fs_info->free_count != _free_count;
+        return true;
+    }
+
+    auto FATCache::flush_fs_info() -> bool {
+        if (_fs_info_sector == 0 || !_fs_info_dirty) return true;
+
+        auto* fs_info       = reinterpret_cast<FileSystemInfo*>(_fs_info_buf);
+        fs_info->free_count = _free_count;
+        fs_info->next_free  = _next_free;
+        if (fc_mass_storage_device_transfer(_mass_storage_dev_handle,
+                                            Device::MassStorageDeviceRequestType::WRITE,
+                                            _fs_info_buf,
+                                            _bpb->bytes_per_sector,
+                                            _fs_info_sector)
+            < _bpb->bytes_per_sector)
+            return false;
+        _fs_info_dirty = false;
+        return true;
+    }
+
+    auto FATCache::get_window(U32 window_idx) -> Window* {
+        Window* window    = &_windows[window_idx];
+        window->last_used = ++_access_clock;
+        if (window->data != nullptr) return window;
+
+        if (_loaded_window_count >= min(_window_count, MAX_WINDOW_COUNT) && !evict_window())
+            return nullptr;
+
+        auto* data       = new U8[WINDOW_SIZE];
+        U32   bytes      = window_sector_count(window_idx) * _bpb->bytes_per_sector;
+        U32   window_lba = _bpb->reserved_sector_count + window_idx * _sectors_per_window;
+        if (fc_mass_storage_device_transfer(_mass_storage_dev_handle,
+                                            Device::MassStorageDeviceRequestType::READ,
+                                            data,
+                                            bytes,
+                                            window_lba)
+            < bytes) {
+            delete[] data;
+            return nullptr;
+        }
+        window->data       = data;
+        window->dirty_mask = 0;
+        _loaded_window_count++;
+        return window;
+    }
+
+    auto FATCache::flush_window(U32 window_idx) -> bool {
+        Window* window = &_windows[window_idx];
+        if (window->dirty_mask == 0) return true;
+
+        U32 sector_count = window_sector_count(window_idx);
+        U32 window_start = window_idx * _sectors_per_window;
+        U32 sector       = 0;
+        while (sector < sector_count) {
+            if ((window->dirty_mask & (1u << sector)) == 0) {
+                sector++;
+                continue;
+            }
+            // Write the whole run of dirty sectors with a single request per FAT copy
+            U32 run_start = sector;
+            while (sector < sector_count && (window->dirty_mask & (1u << sector)) != 0) sector++;
+            U32 bytes = (sector - run_start) * _bpb->bytes_per_sector;
+            for (U8 i = 0; i < _bpb->fat_count; i++) {
+                U32 lba = _bpb->reserved_sector_count + i * _fat_size + window_start + run_start;
+                if (fc_mass_storage_device_transfer(_mass_storage_dev_handle,
+                                                    Device::MassStorageDeviceRequestType::WRITE,
+                                                    &window->data[run_start
+                                                                  * _bpb->bytes_per_sector],
+                                                    bytes,
+                                                    lba)
+                    < bytes)
+                    return false;
+            }
+        }
+        window->dirty_mask = 0;
+        return true;
+    }
+
+    auto FATCache::evict_window() -> bool {
+        Window* lru     = nullptr;
+        U32     lru_idx = 0;
+        for (U32 i = 0; i < _window_count; i++) {
+            if (_windows[i].data == nullptr) continue;
+            if (lru == nullptr || _windows[i].last_used < lru->last_used) {
+                lru     = &_windows[i];
+                lru_idx = i;
+            }
+        }
+        if (lru == nullptr || !flush_window(lru_idx)) return false;
+
+        delete[] lru->data;
+        lru->data = nullptr;
+        _loaded_window_count--;
+        return true;
+    }
+
+    // ========================================================================================== //
+    // FAT Cache
+    // ========================================================================================== //
+
+    FATCache::FATCache(Device::Handle           mass_storage_dev_handle,
+                       BIOSParameterBlock*      bpb,
+                       SharedPointer<FATEngine> fat_engine,
+                       U32                      cluster_count,
+                       U16                      fs_info_sector)
+        : _mass_storage_dev_handle(mass_storage_dev_handle),
+          _bpb(bpb),
+          _fat_engine(move(fat_engine)),
+          _fat_size(_fat_engine->fat_get_size(bpb)),
+          _sectors_per_window(WINDOW_SIZE / bpb->bytes_per_sector),
+          _cluster_count(cluster_count),
+          _windows(nullptr),
+          _window_count((_fat_size + _sectors_per_window - 1) / _sectors_per_window),
+          _loaded_window_count(0),
+          _access_clock(0),
+          _free_map(nullptr),
+          _free_count(0),
+          _next_free(2),
+          _fs_info_sector(fs_info_sector),
+          _fs_info_buf(nullptr),
+          _fs_info_dirty(false) {
+        _windows  = new Window[_window_count];
+        _free_map = new U64[div_round_up(_cluster_count, 64u)];
+        memset(_free_map, 0, div_round_up(_cluster_count, 64u) * sizeof(U64));
+    }
+
+    FATCache::~FATCache() {
+        for (U32 i = 0; i < _window_count; i++) delete[] _windows[i].data;
+        delete[] _windows;
+        delete[] _free_map;
+        delete[] _fs_info_buf;
+    }
+
+    auto FATCache::preload() -> bool {
+        U32 preload_count = min(_window_count, MAX_WINDOW_COUNT);
+        for (U32 i = 0; i < preload_count; i++)
+            if (get_window(i) == nullptr) return false;
+
+        for (U32 cluster = 2; cluster < _cluster_count; cluster++) {
+            U32 fat_entry = 0;
+            if (!read(cluster, fat_entry)) return false;
+            if (fat_entry == 0) mark_free(cluster, true);
+        }
+        return load_fs_info();
+    }
+
+    auto FATCache::get_cluster_count() const -> U32 { return _cluster_count; }
+
+    auto FATCache::get_free_count() const -> U32 { return _free_count; }
+
+    auto FATCache::get_next_free() const -> U32 { return _next_free; }
+
+    void FATCache::set_next_free(U32 cluster) {
+        U32 next_free = cluster >= 2 && cluster < _cluster_count ? cluster : 2;
+        if (next_free == _next_free) return;
+        _next_free     = next_free;
+        _fs_info_dirty = true;
+    }
+
+    auto FATCache::find_free_run(U32 hint, U32 min_length, U32 max_length, U32& out_first) const
+        -> U32 {
+        if (_free_count == 0 || max_length == 0) return 0;
+
+        // A run is probed up to the preferred length, but only max_length clusters are returned
+        U32  probe_limit = max(min_length, max_length);
+        U32  start       = hint >= 2 && hint < _cluster_count ? hint : 2;
+        U32  first_free  = 0;
+        U32  first_len   = 0;
+        U32  cluster     = start;
+        U32  end         = _cluster_count;
+        bool wrapped     = false;
+        while (true) {
+            cluster = find_free(cluster, end);
+            if (cluster == end) {
+                if (wrapped) break;
+                // Continue the search at the start of the volume
+                wrapped = true;
+                cluster = 2;
+                end     = start;
+                continue;
+            }
+
+            U32 run_length = 1;
+            while (run_length < probe_limit && cluster + run_length < _cluster_count
+                   && is_free(cluster + run_length))
+                run_length++;
+            if (run_length >= min_length) {
+                out_first = cluster;
+                return min(run_length, max_length);
+            }
+            if (first_len == 0) {
+                first_free = cluster;
+                first_len  = run_length;
+            }
+            cluster += run_length;
+        }
+        out_first = first_free;
+        return min(first_len, max_length);
+    }
+
+    auto FATCache::read(U32 cluster, U32& out) -> bool {
+        U32 byte_offset = _fat_engine->fat_offset(cluster);
+        U32 window_idx  = byte_offset / WINDOW_SIZE;
+        if (window_idx >= _window_count) return false;
+
+        Window* window = get_window(window_idx);
+        if (window == nullptr) return false;
+        out = _fat_engine->fat_get_entry(window->data, byte_offset % WINDOW_SIZE);
+        return true;
+    }
+
+    auto FATCache::write(U32 cluster, U32 fat_value) -> bool {
+        U32 byte_offset = _fat_engine->fat_offset(cluster);
+        U32 window_idx  = byte_offset / WINDOW_SIZE;
+        if (window_idx >= _window_count) return false;
+
+        Window* window = get_window(window_idx);
+        if (window == nullptr) return false;
+        U32 window_offset = byte_offset % WINDOW_SIZE;
+        _fat_engine->fat_set_entry(window->data, window_offset, fat_value);
+        window->dirty_mask |= 1u << (window_offset / _bpb->bytes_per_sector);
+
+        if (cluster >= 2 && cluster < _cluster_count) {
+            mark_free(cluster, fat_value == 0);
+            if (fat_value != 0 && cluster == _next_free) set_next_free(cluster + 1);
+        }
+        return true;
+    }
+
+    auto FATCache::flush() -> bool {
+        bool flushed = true;
+        for (U32 i = 0; i < _window_count; i++)
+            if (_windows[i].data != nullptr && !flush_window(i)) flushed = false;
+        return flush_fs_info() && flushed;
+    }
+
+    auto FATCache::is_dirty() const -> bool {
+        for (U32 i = 0; i < _window_count; i++)
+            if (_windows[i].dirty_mask != 0) return true;
+        return _fs_info_sector != 0 && _fs_info_dirty;
+    }
+} // namespace Rune::VFS
@@ -58,15 +58,11 @@ namespace Rune::VFS {
 
     auto FATDriver::exists(const SharedPointer<MassStorageDevRef>& md, const Path& path) const
         -> IOStatus {
-        LinkedListIterator<String> it = path.split().begin();
-        NavigationResult           navRes =
-            FATDirectoryIterator::navigate_to(md->m_mass_storage_dev_handle,
-                                              md->m_BPB,
-                                              &_volume_manager,
-                                              _fat_engine->get_root_directory_cluster(md->m_BPB),
-                                              it);
-        if (navRes.status == NavigationStatus::NOT_FOUND) return IOStatus::NOT_FOUND;
-        if (navRes.status == NavigationStatus::FOUND) return IOStatus::FOUND;
+        LocationAwareFileEntry entry;
+        VolumeAccessStatus     st =
+            _file_entry_manager.search(md->m_mass_storage_dev_handle, md->m_BPB, path, entry);
+        if (st == VolumeAccessStatus::NOT_FOUND) return IOStatus::NOT_FOUND;
+        if (st == VolumeAccessStatus::OKAY) return IOStatus::FOUND;
         return IOStatus::DEV_ERROR;
     }
 
@@ -304,10 +300,11 @@ namespace Rune::VFS {
                        : IOStatus::DEV_ERROR;
         }
 
+        U32                  dir_cluster = dir.file.cluster();
         FATDirectoryIterator dIt(md->m_mass_storage_dev_handle,
                                  md->m_BPB,
                                  &_volume_manager,
-                                 dir.file.cluster(),
+                                 dir_cluster,
                                  DirectoryIterationMode::LIST_DIRECTORY);
         while (dIt.has_next()) {
             LocationAwareFileEntry c_entry = *dIt;
@@ -318,6 +315,9 @@ namespace Rune::VFS {
                 delete_file(md, c_entry);
             dIt++;
         }
+        // The cluster of the directory can be reused by another directory
+        _file_entry_manager.dentry_cache_invalidate_directory(md->m_mass_storage_dev_handle,
+                                                              dir_cluster);
 
         // Delete the file entry of the current directory
         return dIt.get_state() == DirectoryIteratorState::END_OF_DIRECTORY
@@ -468,6 +468,11 @@ namespace Rune::VFS {
                + root_dir_sectors);
         U32 total_clusters = data_sectors / bpb->sectors_per_cluster;
         if (!_fat_engine->can_mount(total_clusters)) return MountStatus::NOT_SUPPORTED;
+        if (!_volume_manager.fat_cache_load(mass_storage_dev_handle, bpb, total_clusters)) {
+            delete[] boot_record_buf;
+            return MountStatus::DEV_ERROR;
+        }
+        _file_entry_manager.dentry_cache_load(mass_storage_dev_handle);
 
         _storage_dev_ref_table.add_back(
             SharedPointer<MassStorageDevRef>(new MassStorageDevRef(mass_storage_dev_handle, bpb)));
@@ -477,8 +482,15 @@ namespace Rune::VFS {
     auto FATDriver::unmount(Device::Handle mass_storage_dev_handle) -> MountStatus {
         SharedPointer<MassStorageDevRef> md = find_storage_dev_ref(mass_storage_dev_handle);
         if (!md) return MountStatus::NOT_MOUNTED;
+        _file_entry_manager.dentry_cache_drop(mass_storage_dev_handle);
+        bool flushed = _volume_manager.fat_cache_drop(mass_storage_dev_handle);
         _storage_dev_ref_table.remove(md);
-        return MountStatus::UNMOUNTED;
+        return flushed ? MountStatus::UNMOUNTED : MountStatus::DEV_ERROR;
+    }
+
+    auto FATDriver::sync(Device::Handle mass_storage_dev_handle) -> bool {
+        if (!find_storage_dev_ref(mass_storage_dev_handle)) return false;
+        return _volume_manager.fat_cache_flush(mass_storage_dev_handle);
     }
 
     auto FATDriver::is_valid_file_path(const Path& path) const -> bool {
@@ -497,10 +509,13 @@ namespace Rune::VFS {
         IOStatus st = exists(md, path);
         if (st != IOStatus::NOT_FOUND) return st;
 
-        U8 fat_attributes = node_attributes_to_fat_file_attributes(attributes);
-        return ((fat_attributes & FATFileAttribute::DIRECTORY) != 0)
-                   ? create_directory(md, path, fat_attributes)
-                   : create_file(md, path, fat_attributes);
+        U8       fat_attributes = node_attributes_to_fat_file_attributes(attributes);
+        IOStatus cs             = ((fat_attributes & FATFileAttribute::DIRECTORY) != 0)
+                                      ? create_directory(md, path, fat_attributes)
+                                      : create_file(md, path, fat_attributes);
+        // The path was cached as not existing by the exists() check
+        _file_entry_manager.dentry_cache_invalidate(mass_storage_dev_handle, md->m_BPB, path);
+        return cs;
     }
 
     auto FATDriver::open(U16                  mass_storage_dev_handle,
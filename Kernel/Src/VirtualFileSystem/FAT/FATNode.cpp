@@ -18,43 +18,216 @@
 
 #include <KRE/BitsAndBytes.h>
 #include <KRE/Math.h>
+#include <KRE/System/System.h>
+
+#include <CPU/CPUModule.h>
 
 #include <VirtualFileSystem/FAT/FATDirectoryIterator.h>
 
 namespace Rune::VFS {
+    auto fn_time_since_start() -> U64 {
+        return System::instance()
+            .get_module<CPU::CPUModule>(ModuleSelector::CPU)
+            ->get_system_timer()
+            ->get_time_since_start();
+    }
+
     void FATNode::init_file_cursor() {
-        U32 i = 0;
-        U32 last_file_cluster =
+        if (_node_io_mode == Ember::IOMode::APPEND) {
+            // Move the cursor to the end of the file
+            U32 cluster_size = _mounted_storage->m_BPB->bytes_per_sector
+                               * _mounted_storage->m_BPB->sectors_per_cluster;
+            move_cursor(_file_entry.file.file_size / cluster_size);
+            _cluster_offset = _file_entry.file.file_size % cluster_size;
+        } else {
+            move_cursor(0);
+        }
+    }
+
+    auto FATNode::processed_bytes() const -> U32 {
+        return (_processed_clusters * _mounted_storage->m_BPB->bytes_per_sector
+                * _mounted_storage->m_BPB->sectors_per_cluster)
+               + _cluster_offset;
+    }
+
+    void FATNode::load_extent_map() {
+        if (_extent_map_valid) return;
+
+        _extent_count    = 0;
+        U32 file_cluster = 0;
+        U32 cluster =
             _file_entry.file.first_cluster_high << SHIFT_16 | _file_entry.file.first_cluster_low;
-        U32 cluster = last_file_cluster;
         while (cluster != 0 && cluster < _volume_manager->get_max_cluster_count() + 1) {
-            last_file_cluster = cluster;
+            Extent* last = _extent_count > 0 ? &_extent_map[_extent_count - 1] : nullptr;
+            if (last != nullptr && last->first_cluster + last->length == cluster) {
+                // The cluster continues the current run
+                last->length++;
+            } else {
+                if (_extent_count == _extent_capacity) {
+                    U32   new_capacity = max(_extent_capacity * 2, MIN_EXTENT_CAPACITY);
+                    auto* new_map      = new Extent[new_capacity];
+                    if (_extent_map != nullptr) {
+                        memcpy(new_map, _extent_map, _extent_count * sizeof(Extent));
+                        delete[] _extent_map;
+                    }
+                    _extent_map      = new_map;
+                    _extent_capacity = new_capacity;
+                }
+                _extent_map[_extent_count++] = {.file_cluster  = file_cluster,
+                                                .first_cluster = cluster,
+                                                .length        = 1};
+            }
             cluster = _volume_manager->fat_read(_mounted_storage->m_mass_storage_dev_handle,
                                                 _mounted_storage->m_BPB,
                                                 cluster);
-            i++;
+            file_cluster++;
         }
+        _extent_map_valid = true;
+    }
 
-        // Move the cluster cursor
-        if (_node_io_mode == Ember::IOMode::APPEND) {
-            U32 cluster_size    = _mounted_storage->m_BPB->bytes_per_sector
-                                  * _mounted_storage->m_BPB->sectors_per_cluster;
-            _processed_clusters = i;
-            if (_file_entry.file.file_size % cluster_size != 0) _processed_clusters--;
-            _current_cluster = last_file_cluster;
-            _cluster_offset  = _file_entry.file.file_size - (_processed_clusters * cluster_size);
+    auto FATNode::find_extent(U32 file_cluster) const -> const Extent* {
+        U32 low  = 0;
+        U32 high = _extent_count;
+        while (low < high) {
+            U32           mid    = low + ((high - low) / 2);
+            const Extent& extent = _extent_map[mid];
+            if (file_cluster < extent.file_cluster)
+                high = mid;
+            else if (file_cluster >= extent.file_cluster + extent.length)
+                low = mid + 1;
+            else
+                return &extent;
+        }
+        return nullptr;
+    }
+
+    void FATNode::move_cursor(U32 file_cluster) {
+        load_extent_map();
+        _cluster_offset      = 0;
+        const Extent* extent = find_extent(file_cluster);
+        if (extent != nullptr) {
+            _processed_clusters = file_cluster;
+            _current_cluster    = extent->first_cluster + (file_cluster - extent->file_cluster);
+        } else if (_extent_count > 0) {
+            // Behind the cluster chain -> Point at the end of the last cluster
+            const Extent& last  = _extent_map[_extent_count - 1];
+            _processed_clusters = last.file_cluster + last.length;
+            _current_cluster    = last.first_cluster + last.length - 1;
         } else {
+            // The file has no clusters
             _processed_clusters = 0;
-            _current_cluster    = _file_entry.file.first_cluster_high << SHIFT_16
-                                  | _file_entry.file.first_cluster_low;
-            _cluster_offset     = 0;
+            _current_cluster    = 0;
         }
     }
 
-    auto FATNode::processed_bytes() const -> U32 {
-        return (_processed_clusters * _mounted_storage->m_BPB->bytes_per_sector
-                * _mounted_storage->m_BPB->sectors_per_cluster)
-               + _cluster_offset;
+    void FATNode::update_read_ahead_window() {
+        U32 cluster_size = _mounted_storage->m_BPB->bytes_per_sector
+                           * _mounted_storage->m_BPB->sectors_per_cluster;
+        if (processed_bytes() != _next_sequential_read) {
+            // Random access -> Reading ahead would only waste storage bandwidth
+            _read_ahead_window = 0;
+            return;
+        }
+        U32 min_window     = max(MIN_READ_AHEAD_SIZE / cluster_size, static_cast<U32>(1));
+        U32 max_window     = max(MAX_READ_AHEAD_SIZE / cluster_size, static_cast<U32>(1));
+        _read_ahead_window = _read_ahead_window == 0 ? min_window
+                                                     : min(_read_ahead_window * 2, max_window);
+    }
+
+    auto FATNode::read_ahead(U32 window) -> bool {
+        U32 cluster_size = _mounted_storage->m_BPB->bytes_per_sector
+                           * _mounted_storage->m_BPB->sectors_per_cluster;
+        if (_read_ahead_buf == nullptr) {
+            U32 max_window  = max(MAX_READ_AHEAD_SIZE / cluster_size, static_cast<U32>(1));
+            _read_ahead_buf = new U8[static_cast<size_t>(max_window) * cluster_size];
+        }
+
+        // Do not read ahead beyond the end of the file
+        U32 file_clusters = div_round_up(_file_entry.file.file_size, cluster_size);
+        U32 count         = min(window, file_clusters - _processed_clusters);
+        _read_ahead_first = _processed_clusters;
+        _read_ahead_count = 0;
+        while (_read_ahead_count < count) {
+            U32           file_cluster = _read_ahead_first + _read_ahead_count;
+            const Extent* extent       = find_extent(file_cluster);
+            if (extent == nullptr) break; // The cluster chain is shorter than the file
+
+            U32 run_length = min(count - _read_ahead_count,
+                                 extent->file_cluster + extent->length - file_cluster);
+            if (!_volume_manager->data_cluster_run_read(
+                    _mounted_storage->m_mass_storage_dev_handle,
+                    _mounted_storage->m_BPB,
+                    &_read_ahead_buf[static_cast<size_t>(_read_ahead_count) * cluster_size],
+                    extent->first_cluster + (file_cluster - extent->file_cluster),
+                    run_length)) {
+                _read_ahead_count = 0;
+                return false;
+            }
+            _read_ahead_count += run_length;
+        }
+        return true;
+    }
+
+    auto FATNode::get_write_behind_cluster(size_t cluster_size, bool keep_content) -> U8* {
+        auto capacity =
+            static_cast<U32>(max(WRITE_BEHIND_SIZE / cluster_size, static_cast<size_t>(1)));
+        if (_write_behind_buf == nullptr) _write_behind_buf = new U8[capacity * cluster_size];
+
+        if (_write_behind_count > 0 && _current_cluster >= _write_behind_first
+            && _current_cluster < _write_behind_first + _write_behind_count)
+            // The cluster is already buffered
+            return &_write_behind_buf[(_current_cluster - _write_behind_first) * cluster_size];
+
+        if (_write_behind_count == capacity
+            || (_write_behind_count > 0
+                && _current_cluster != _write_behind_first + _write_behind_count)) {
+            // The cluster does not continue the buffered run -> Start a new run
+            if (!flush_write_behind()) return nullptr;
+        }
+        if (_write_behind_count == 0) {
+            _write_behind_first = _current_cluster;
+            _write_behind_start = fn_time_since_start();
+        }
+
+        U8* cluster_buf = &_write_behind_buf[_write_behind_count * cluster_size];
+        if (keep_content) {
+            if (!_volume_manager->data_cluster_read(_mounted_storage->m_mass_storage_dev_handle,
+                                                    _mounted_storage->m_BPB,
+                                                    cluster_buf,
+                                                    _current_cluster))
+                return nullptr;
+        } else {
+            memset(cluster_buf, 0, cluster_size);
+        }
+        _write_behind_count++;
+        return cluster_buf;
+    }
+
+    auto FATNode::flush_write_behind() -> bool {
+        if (_write_behind_count == 0) return true;
+
+        if (!_volume_manager->data_cluster_run_write(_mounted_storage->m_mass_storage_dev_handle,
+                                                     _mounted_storage->m_BPB,
+                                                     _write_behind_buf,
+                                                     _write_behind_first,
+                                                     _write_behind_count))
+            return false;
+        _write_behind_count = 0;
+        return true;
+    }
+
+    auto FATNode::write_behind_expired() const -> bool {
+        return _write_behind_count > 0
+               && fn_time_since_start() - _write_behind_start >= WRITE_BEHIND_TIMEOUT;
+    }
+
+    auto FATNode::sync_file_nodes(bool drop_read_ahead) -> bool {
+        for (auto* node : _mounted_storage->m_open_nodes) {
+            if (node == this || !(node->_path == _path)) continue;
+            if (!node->flush_write_behind()) return false;
+            if (drop_read_ahead) node->_read_ahead_count = 0;
+        }
+        return true;
     }
 
     FATNode::FATNode(Function<void()>                 on_close,
@@ -72,6 +245,14 @@ namespace Rune::VFS {
           _file_entry_manager(file_entry_manager),
           _mounted_storage(move(mounted_storage)) {
         init_file_cursor();
+        _mounted_storage->m_open_nodes.add_back(this);
+    }
+
+    FATNode::~FATNode() {
+        _mounted_storage->m_open_nodes.remove(this);
+        delete[] _extent_map;
+        delete[] _read_ahead_buf;
+        delete[] _write_behind_buf;
     }
 
     auto FATNode::get_node_path() const -> Path { return _path; }
@@ -99,38 +280,65 @@ namespace Rune::VFS {
 
         if (buf_size == 0) return {.status = NodeIOStatus::OKAY, .byte_count = 0};
 
+        // Buffered clusters of all nodes of the file must be on the volume before they can be read
+        if (!flush_write_behind() || !sync_file_nodes(false))
+            return {.status = NodeIOStatus::DEV_ERROR, .byte_count = 0};
+
         auto   cluster_size = static_cast<size_t>(_mounted_storage->m_BPB->bytes_per_sector
                                                   * _mounted_storage->m_BPB->sectors_per_cluster);
-        U8     tmp_buf[cluster_size]; // NOLINT
-        size_t buf_pos = 0;
+        auto*  dest         = reinterpret_cast<U8*>(buf);
+        size_t buf_pos      = 0;
+        load_extent_map();
+        update_read_ahead_window();
         while (has_more() && buf_pos < buf_size) {
-            if (!_volume_manager->data_cluster_read(_mounted_storage->m_mass_storage_dev_handle,
-                                                    _mounted_storage->m_BPB,
-                                                    tmp_buf,
-                                                    _current_cluster))
-                return {.status = NodeIOStatus::DEV_ERROR, .byte_count = buf_pos};
-
-            // 1. Min: Copy no more bytes than in the file or buffer left
-            // 2. Min: Copy no more bytes than in the cluster or "1. Min" left
-            size_t b_to_copy =
-                min(min(static_cast<size_t>(_file_entry.file.file_size) - processed_bytes(),
-                        buf_size - buf_pos),
-                    cluster_size - _cluster_offset);
-            memcpy(&(reinterpret_cast<U8*>(buf))[buf_pos], &tmp_buf[_cluster_offset], b_to_copy);
-            _cluster_offset += b_to_copy;
-            buf_pos         += b_to_copy;
+            const Extent* extent = find_extent(_processed_clusters);
+            if (extent == nullptr) break; // The cluster chain is shorter than the file
+
+            // Copy no more bytes than in the file or buffer left
+            size_t to_read =
+                min(static_cast<size_t>(_file_entry.file.file_size) - processed_bytes(),
+                    buf_size - buf_pos);
+            if (_processed_clusters >= _read_ahead_first
+                && _processed_clusters < _read_ahead_first + _read_ahead_count) {
+                // The cluster was read ahead -> Copy it from the read-ahead buffer
+                size_t b_to_copy  = min(to_read, cluster_size - _cluster_offset);
+                size_t ra_buf_pos = ((_processed_clusters - _read_ahead_first) * cluster_size)
+                                    + _cluster_offset;
+                memcpy(&dest[buf_pos], &_read_ahead_buf[ra_buf_pos], b_to_copy);
+                _cluster_offset += b_to_copy;
+                buf_pos         += b_to_copy;
+
+                if (_cluster_offset >= cluster_size) move_cursor(_processed_clusters + 1);
+                continue;
+            }
 
-            if (_cluster_offset >= cluster_size) {
-                U32 next_cluster =
-                    _volume_manager->fat_read(_mounted_storage->m_mass_storage_dev_handle,
-                                              _mounted_storage->m_BPB,
-                                              _current_cluster);
-                if (next_cluster >= _volume_manager->get_max_cluster_count() + 1) break;
-                _processed_clusters++;
-                _current_cluster = next_cluster;
-                _cluster_offset  = 0;
+            // A sequential read smaller than the read-ahead window goes through the read-ahead
+            // buffer, so the next reads are served by the same storage request
+            size_t read_ahead_size = static_cast<size_t>(_read_ahead_window) * cluster_size;
+            if (_cluster_offset == 0 && to_read >= cluster_size && to_read >= read_ahead_size) {
+                // Read all whole clusters of the current run directly into the buffer
+                U32 cluster_count =
+                    min(static_cast<U32>(to_read / cluster_size),
+                        extent->file_cluster + extent->length - _processed_clusters);
+                if (!_volume_manager->data_cluster_run_read(
+                        _mounted_storage->m_mass_storage_dev_handle,
+                        _mounted_storage->m_BPB,
+                        &dest[buf_pos],
+                        _current_cluster,
+                        cluster_count))
+                    return {.status = NodeIOStatus::DEV_ERROR, .byte_count = buf_pos};
+                buf_pos += cluster_count * cluster_size;
+                move_cursor(_processed_clusters + cluster_count);
+                continue;
             }
+
+            // Only a part of the cluster is needed or the file is read sequentially -> Read it into
+            // the read-ahead buffer, if the file is read sequentially the next clusters are read in
+            // the same request
+            if (!read_ahead(max(_read_ahead_window, static_cast<U32>(1))))
+                return {.status = NodeIOStatus::DEV_ERROR, .byte_count = buf_pos};
         }
+        _next_sequential_read = processed_bytes();
         return {.status = NodeIOStatus::OKAY, .byte_count = buf_pos};
     }
 
@@ -151,41 +359,79 @@ namespace Rune::VFS {
                                                     * _mounted_storage->m_BPB->sectors_per_cluster);
         size_t buf_pos        = 0;
         bool   is_first_write = _processed_clusters == 0 && _cluster_offset == 0;
+        U32    chain_length   =
+            div_round_up(_file_entry.file.file_size, static_cast<U32>(cluster_size));
+        // The read-ahead buffers could contain clusters that are overwritten now and the clusters
+        // other nodes have buffered must not be written after this write
+        _read_ahead_count = 0;
+        if (!sync_file_nodes(true)) return {.status = NodeIOStatus::DEV_ERROR, .byte_count = 0};
         while (buf_pos < buf_size) {
-            if (_current_cluster == 0
-                || _processed_clusters >= div_round_up(_file_entry.file.file_size,
-                                                       static_cast<U32>(cluster_size))) {
-                // End of file reached -> Allocate new cluster
-                _current_cluster = _file_entry_manager->allocate_cluster(
+            if (_current_cluster == 0 || _processed_clusters >= chain_length) {
+                // End of file reached -> Allocate the clusters for the rest of the buffer at once,
+                // so they are placed in as few cluster runs as possible
+                auto to_allocate = static_cast<U32>(div_round_up(buf_size - buf_pos, cluster_size));
+                _current_cluster = _file_entry_manager->allocate_clusters(
                     _mounted_storage->m_mass_storage_dev_handle,
                     _mounted_storage->m_BPB,
                     _file_entry,
-                    _current_cluster);
+                    _current_cluster,
+                    to_allocate);
                 if (_current_cluster == 0)
                     return {.status = NodeIOStatus::DEV_ERROR, .byte_count = 0};
+                chain_length      += to_allocate;
+                _extent_map_valid  = false;
             }
 
-            // Read current cluster
-            U8 w_buf[cluster_size]; // NOLINT
-            if (!_volume_manager->data_cluster_read(_mounted_storage->m_mass_storage_dev_handle,
-                                                    _mounted_storage->m_BPB,
-                                                    w_buf,
-                                                    _current_cluster))
-                return {.status = NodeIOStatus::DEV_ERROR, .byte_count = buf_pos};
-            // Copy buffer bytes to the cluster buffer
-            size_t b_to_copy = min(buf_size - buf_pos, cluster_size - _cluster_offset);
-            memcpy(&w_buf[_cluster_offset],
-                   &(reinterpret_cast<U8*>(buf))[buf_pos],
-                   b_to_copy); // _cluster_offset needs update
-            if (_node_io_mode == Ember::IOMode::WRITE && is_first_write)
-                memset(&w_buf[b_to_copy], 0, cluster_size - b_to_copy);
-
-            // Write updated cluster to volume
-            if (!_volume_manager->data_cluster_write(_mounted_storage->m_mass_storage_dev_handle,
-                                                     _mounted_storage->m_BPB,
-                                                     w_buf,
-                                                     _current_cluster))
-                return {.status = NodeIOStatus::DEV_ERROR, .byte_count = 0};
+            size_t whole_clusters = (buf_size - buf_pos) / cluster_size;
+            if (_cluster_offset == 0 && whole_clusters * cluster_size >= WRITE_BEHIND_SIZE) {
+                // The write is larger than the write-behind buffer -> Write the whole clusters of
+                // the current run directly from the buffer instead of copying them
+                if (!flush_write_behind())
+                    return {.status = NodeIOStatus::DEV_ERROR, .byte_count = 0};
+
+                U32 run_length   = 1;
+                U32 next_cluster = _volume_manager->fat_read(
+                    _mounted_storage->m_mass_storage_dev_handle,
+                    _mounted_storage->m_BPB,
+                    _current_cluster);
+                while (run_length < whole_clusters
+                       && _processed_clusters + run_length < chain_length
+                       && next_cluster == _current_cluster + run_length) {
+                    next_cluster = _volume_manager->fat_read(
+                        _mounted_storage->m_mass_storage_dev_handle,
+                        _mounted_storage->m_BPB,
+                        next_cluster);
+                    run_length++;
+                }
+                if (!_volume_manager->data_cluster_run_write(
+                        _mounted_storage->m_mass_storage_dev_handle,
+                        _mounted_storage->m_BPB,
+                        &(reinterpret_cast<U8*>(buf))[buf_pos],
+                        _current_cluster,
+                        run_length))
+                    return {.status = NodeIOStatus::DEV_ERROR, .byte_count = 0};
+                buf_pos             += run_length * cluster_size;
+                _processed_clusters += run_length;
+
+                if (next_cluster < _volume_manager->get_max_cluster_count() + 1)
+                    _current_cluster = next_cluster;
+                else
+                    chain_length = min(chain_length, _processed_clusters);
+                continue;
+            }
+
+            // The old cluster content is only needed if the cluster contains file data that is
+            // not overwritten
+            size_t b_to_copy    = min(buf_size - buf_pos, cluster_size - _cluster_offset);
+            bool   keep_content = !(_node_io_mode == Ember::IOMode::WRITE && is_first_write)
+                                && (_cluster_offset > 0 || b_to_copy < cluster_size)
+                                && _processed_clusters * cluster_size < _file_entry.file.file_size;
+
+            // Copy buffer bytes to the write-behind buffer, it is written to the volume in a
+            // single request once the run of clusters is complete
+            U8* w_buf = get_write_behind_cluster(cluster_size, keep_content);
+            if (w_buf == nullptr) return {.status = NodeIOStatus::DEV_ERROR, .byte_count = 0};
+            memcpy(&w_buf[_cluster_offset], &(reinterpret_cast<U8*>(buf))[buf_pos], b_to_copy);
             buf_pos         += b_to_copy;
             _cluster_offset += b_to_copy;
 
@@ -200,8 +446,14 @@ namespace Rune::VFS {
                                               _current_cluster);
                 if (next_cluster < _volume_manager->get_max_cluster_count() + 1)
                     _current_cluster = next_cluster;
+                else
+                    // The chain ends here, e.g. because fewer clusters than requested were
+                    // allocated
+                    chain_length = min(chain_length, _processed_clusters);
             }
         };
+        if (write_behind_expired() && !flush_write_behind())
+            return {.status = NodeIOStatus::DEV_ERROR, .byte_count = 0};
 
         // Update file size
         U32 old_size               = _file_entry.file.file_size;
@@ -211,6 +463,7 @@ namespace Rune::VFS {
 
         if (_file_entry.file.file_size < old_size) {
             // The file shrunk -> Free excess FAT clusters
+            _extent_map_valid = false;
             U32 total_clusters =
                 div_round_up(_file_entry.file.file_size, static_cast<U32>(cluster_size));
             U32 cluster     = _file_entry.file.first_cluster_high << SHIFT_16
@@ -282,34 +535,9 @@ namespace Rune::VFS {
             case Ember::SeekMode::END:    to_seek = _file_entry.file.file_size + offset; break;
             default:                      break;
         }
-        // Hyper Optimization: Buffer the FAT clusters -> These vars can be instantly computed
-        // _processed_clusters = bytePos / clusterSize
-        // _current_cluster = clusterBuffer[_processed_clusters]
-        // _cluster_offset = bytePos % clusterSize
-        _processed_clusters = 0;
-        _current_cluster    = 0;
-        _cluster_offset     = 0;
-        U32 cluster =
-            _file_entry.file.first_cluster_high << SHIFT_16 | _file_entry.file.first_cluster_low;
-        _current_cluster = cluster;
-        while (to_seek > 0) {
-            if (to_seek < cluster_size) {
-                _cluster_offset = to_seek;
-                to_seek         = 0;
-            } else {
-                cluster = _volume_manager->fat_read(_mounted_storage->m_mass_storage_dev_handle,
-                                                    _mounted_storage->m_BPB,
-                                                    cluster);
-                if (cluster == 0 && cluster >= _volume_manager->get_max_cluster_count() + 1)
-                    return {.status = NodeIOStatus::DEV_ERROR, .byte_count = offset - to_seek};
-
-                _processed_clusters++;
-                _current_cluster  = cluster;
-                _cluster_offset   = 0;
-                to_seek          -= cluster_size;
-            }
-        }
-        return {.status = NodeIOStatus::OKAY, .byte_count = abs(offset) - to_seek};
+        move_cursor(to_seek / cluster_size);
+        _cluster_offset = to_seek % cluster_size;
+        return {.status = NodeIOStatus::OKAY, .byte_count = static_cast<size_t>(abs(offset))};
     }
 
     auto FATNode::has_attribute(Ember::NodeAttribute f_attr) const -> bool {
@@ -338,4 +566,6 @@ namespace Rune::VFS {
                                            _mounted_storage->m_BPB,
                                            _file_entry);
     }
+
+    auto FATNode::flush() -> bool { return flush_write_behind(); }
 } // namespace Rune::VFS
@@ -17,6 +17,7 @@
 #include <VirtualFileSystem/FAT/FileEntryManager.h>
 
 #include <KRE/BitsAndBytes.h>
+#include <KRE/Math.h>
 
 namespace Rune::VFS {
     DEFINE_ENUM(VolumeAccessStatus, VOLUME_ACCESS_STATUSES, 0x0)
@@ -26,6 +27,43 @@ namespace Rune::VFS {
         : _fat_engine(move(fat_engine)),
           _volume_manager(volume_manager) {}
 
+    auto FileEntryManager::find_dentry_cache(Device::Handle mass_storage_dev_handle) const
+        -> DentryCache* {
+        auto it = _dentry_cache_table.find(mass_storage_dev_handle);
+        return it != _dentry_cache_table.end() ? it->value->get() : nullptr;
+    }
+
+    void FileEntryManager::dentry_cache_load(Device::Handle mass_storage_dev_handle) {
+        _dentry_cache_table.put(mass_storage_dev_handle,
+                                SharedPointer<DentryCache>(new DentryCache()));
+    }
+
+    void FileEntryManager::dentry_cache_drop(Device::Handle mass_storage_dev_handle) {
+        _dentry_cache_table.remove(mass_storage_dev_handle);
+    }
+
+    void FileEntryManager::dentry_cache_invalidate(Device::Handle      mass_storage_dev_handle,
+                                                   BIOSParameterBlock* bpb,
+                                                   const Path&         path) {
+        DentryCache* cache = find_dentry_cache(mass_storage_dev_handle);
+        if (cache == nullptr) return;
+
+        LocationAwareFileEntry parent;
+        if (search(mass_storage_dev_handle, bpb, path.get_parent().resolve(Path("")), parent)
+            != VolumeAccessStatus::OKAY) {
+            // The dentry cannot be found without its parent -> Forget everything to be safe
+            cache->clear();
+            return;
+        }
+        cache->invalidate(parent.file.cluster(), path.get_file_name());
+    }
+
+    void FileEntryManager::dentry_cache_invalidate_directory(Device::Handle mass_storage_dev_handle,
+                                                             U32            dir_cluster) {
+        DentryCache* cache = find_dentry_cache(mass_storage_dev_handle);
+        if (cache != nullptr) cache->invalidate_directory(dir_cluster);
+    }
+
     auto FileEntryManager::search(U16                     mass_storage_dev_handle,
                                   BIOSParameterBlock*     bpb,
                                   const Path&             path,
@@ -36,15 +74,49 @@ namespace Rune::VFS {
         root_dummy.first_cluster_low  = word_get(root_cluster, 0);
         root_dummy.first_cluster_high = word_get(root_cluster, 1);
 
+        LocationAwareFileEntry root = {
+            .file_name       = "",
+            .file            = root_dummy,
+            .location        = {.cluster = root_cluster, .entry_idx = 0},
+            .first_lfn_entry = {           .cluster = 0, .entry_idx = 0}
+        };
+
         LinkedList<String> p_split = path.split();
         if (p_split.empty()
             || (p_split.size() == 1 && (p_split.first() == "." || p_split.first() == ".."))) {
-            out = {
-                .file_name       = "",
-                .file            = root_dummy,
-                .location        = {.cluster = root_cluster, .entry_idx = 0},
-                .first_lfn_entry = {           .cluster = 0, .entry_idx = 0}
-            };
+            out = root;
+            return VolumeAccessStatus::OKAY;
+        }
+
+        DentryCache* cache = find_dentry_cache(mass_storage_dev_handle);
+        if (cache != nullptr) {
+            // Resolve the path one component at a time, a directory is only searched on the volume
+            // if the component is not cached
+            LocationAwareFileEntry current = root;
+            for (const auto& name : p_split) {
+                if (!current.file.has_attribute(FATFileAttribute::DIRECTORY))
+                    return VolumeAccessStatus::BAD_PATH;
+
+                U32                parent_cluster = current.file.cluster();
+                DentryLookupResult lookup         = cache->lookup(parent_cluster, name, current);
+                if (lookup == DentryLookupResult::NEGATIVE_HIT)
+                    return VolumeAccessStatus::NOT_FOUND;
+                if (lookup == DentryLookupResult::HIT) continue;
+
+                LinkedList<String>         component = {name};
+                LinkedListIterator<String> c_it      = component.begin();
+                NavigationResult           nav_res   = FATDirectoryIterator::navigate_to(
+                    mass_storage_dev_handle, bpb, _volume_manager, parent_cluster, c_it);
+                if (nav_res.status == NavigationStatus::NOT_FOUND) {
+                    cache->insert_negative(parent_cluster, name);
+                    return VolumeAccessStatus::NOT_FOUND;
+                }
+                if (nav_res.status != NavigationStatus::FOUND)
+                    return VolumeAccessStatus::DEV_ERROR;
+                cache->insert(parent_cluster, name, nav_res.file);
+                current = nav_res.file;
+            }
+            out = current;
             return VolumeAccessStatus::OKAY;
         }
 
@@ -84,19 +156,8 @@ namespace Rune::VFS {
             };
         } else {
             // Get the directory file entry
-            LinkedListIterator<String> p_it = p_split.begin();
-            NavigationResult nav_res = FATDirectoryIterator::navigate_to(mass_storage_dev_handle,
-                                                                         bpb,
-                                                                         _volume_manager,
-                                                                         root_dummy.cluster(),
-                                                                         p_it);
-            dir                      = nav_res.file;
-
-            if (nav_res.status != NavigationStatus::FOUND) {
-                if (nav_res.status == NavigationStatus::NOT_FOUND)
-                    return VolumeAccessStatus::NOT_FOUND;
-                return VolumeAccessStatus::DEV_ERROR;
-            }
+            VolumeAccessStatus st = search(mass_storage_dev_handle, bpb, path, dir);
+            if (st != VolumeAccessStatus::OKAY) return st;
         }
 
         FATDirectoryIterator dIt(mass_storage_dev_handle,
@@ -184,57 +245,106 @@ namespace Rune::VFS {
             return false;
         auto* file_cluster                     = reinterpret_cast<FileEntry*>(buf);
         file_cluster[entry.location.entry_idx] = entry.file;
-        return _volume_manager->data_cluster_write(mass_storage_dev_handle,
-                                                   bpb,
-                                                   buf,
-                                                   entry.location.cluster);
+        if (!_volume_manager->data_cluster_write(mass_storage_dev_handle,
+                                                 bpb,
+                                                 buf,
+                                                 entry.location.cluster))
+            return false;
+
+        DentryCache* cache = find_dentry_cache(mass_storage_dev_handle);
+        if (cache != nullptr) cache->update(entry);
+        return true;
     }
 
     auto FileEntryManager::allocate_cluster(U16                     mass_storage_dev,
                                             BIOSParameterBlock*     bpb,
                                             LocationAwareFileEntry& file,
                                             U32                     last_file_cluster) -> U32 {
-        U32 free_cluster = _volume_manager->fat_find_next_free_cluster(mass_storage_dev, bpb);
-        if (free_cluster == 0) return 0;
-
-        if (last_file_cluster == 0) {
-            // File of length zero -> Update the file entry and the FAT
-            // Note: Regarding the root cluster it is never empty as the root sector is always
-            // implicitly allocated
-            //          in the BPB, therefore this case can never occur, and we will never
-            //          accidentally update the non-existing root file entry, thus provoking the end
-            //          of the world
-            file.file.first_cluster_low  = word_get(free_cluster, 0);
-            file.file.first_cluster_high = word_get(free_cluster, 1);
-            if (!update(mass_storage_dev, bpb, file)) return 0;
-            if (!_volume_manager->fat_write(mass_storage_dev,
-                                            bpb,
-                                            free_cluster,
-                                            _fat_engine->fat_get_eof_marker())) {
-                file.file.first_cluster_low  = 0;
-                file.file.first_cluster_high = 0;
-                update(mass_storage_dev, bpb, file);
-                return 0;
+        return allocate_clusters(mass_storage_dev, bpb, file, last_file_cluster, 1);
+    }
+
+    auto FileEntryManager::allocate_clusters(U16                     mass_storage_dev,
+                                             BIOSParameterBlock*     bpb,
+                                             LocationAwareFileEntry& file,
+                                             U32                     last_file_cluster,
+                                             U32                     count) -> U32 {
+        U32 first_new_cluster = 0;
+        U32 last_cluster      = last_file_cluster;
+        while (count > 0) {
+            // Try to continue right after the last cluster of the file
+            U32 run_first  = 0;
+            U32 run_length = 0;
+            if (last_cluster > 0)
+                run_length = _volume_manager->fat_find_free_cluster_run(mass_storage_dev,
+                                                                        bpb,
+                                                                        last_cluster + 1,
+                                                                        1,
+                                                                        count,
+                                                                        run_first);
+            bool new_extent = run_length == 0 || run_first != last_cluster + 1;
+            if (new_extent) {
+                // Start a new extent in a free area big enough for the file to grow
+                run_length = _volume_manager->fat_find_free_cluster_run(
+                    mass_storage_dev,
+                    bpb,
+                    0,
+                    max(count, EXTENT_PREALLOCATION),
+                    count,
+                    run_first);
+                if (run_length == 0) break;
             }
-        } else {
-            // File has at least one cluster -> Update the last file cluster in the FAT to point to
-            // the new cluster and update the new cluster in the FAT to the EOF marker
-            // NOLINTBEGIN
-            if (!_volume_manager->fat_write(mass_storage_dev, bpb, last_file_cluster, free_cluster))
-                return 0;
-            // NOLINTEND
-            if (!_volume_manager->fat_write(mass_storage_dev,
-                                            bpb,
-                                            free_cluster,
-                                            _fat_engine->fat_get_eof_marker())) {
-                _volume_manager->fat_write(mass_storage_dev,
-                                           bpb,
-                                           last_file_cluster,
-                                           _fat_engine->fat_get_eof_marker());
-                return 0;
+
+            // Chain the clusters of the run and terminate the chain with the EOF marker
+            for (U32 i = 0; i < run_length; i++) {
+                U32 next =
+                    i + 1 < run_length ? run_first + i + 1 : _fat_engine->fat_get_eof_marker();
+                if (!_volume_manager->fat_write(mass_storage_dev, bpb, run_first + i, next)) {
+                    free_cluster_run(mass_storage_dev, bpb, run_first, i);
+                    return first_new_cluster;
+                }
             }
+
+            if (last_cluster == 0) {
+                // File of length zero -> Update the file entry
+                // Note: Regarding the root cluster it is never empty as the root sector is always
+                // implicitly allocated in the BPB, therefore this case can never occur, and we will
+                // never accidentally update the non-existing root file entry, thus provoking the
+                // end of the world
+                file.file.first_cluster_low  = word_get(run_first, 0);
+                file.file.first_cluster_high = word_get(run_first, 1);
+                if (!update(mass_storage_dev, bpb, file)) {
+                    file.file.first_cluster_low  = 0;
+                    file.file.first_cluster_high = 0;
+                    free_cluster_run(mass_storage_dev, bpb, run_first, run_length);
+                    return 0;
+                }
+            } else if (!_volume_manager->fat_write(mass_storage_dev,
+                                                   bpb,
+                                                   last_cluster,
+                                                   run_first)) {
+                // Could not link the run to the end of the file
+                free_cluster_run(mass_storage_dev, bpb, run_first, run_length);
+                return first_new_cluster;
+            }
+
+            if (new_extent)
+                // Keep the clusters after the run free for the file to grow into
+                _volume_manager->fat_set_next_free_cluster(
+                    mass_storage_dev,
+                    run_first + max(run_length, EXTENT_PREALLOCATION));
+            if (first_new_cluster == 0) first_new_cluster = run_first;
+            last_cluster  = run_first + run_length - 1;
+            count        -= run_length;
         }
-        return free_cluster;
+        return first_new_cluster;
+    }
+
+    void FileEntryManager::free_cluster_run(U16                 mass_storage_dev,
+                                            BIOSParameterBlock* bpb,
+                                            U32                 first_cluster,
+                                            U32                 length) {
+        for (U32 i = 0; i < length; i++)
+            _volume_manager->fat_write(mass_storage_dev, bpb, first_cluster + i, 0);
     }
 
 } // namespace Rune::VFS
\ No newline at end of file
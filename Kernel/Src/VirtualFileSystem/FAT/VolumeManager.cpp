@@ -33,6 +33,12 @@ namespace Rune::VFS {
                + ((cluster - 2) * bpb->sectors_per_cluster);
     }
 
+    auto VolumeManager::find_fat_cache(Device::Handle mass_storage_dev_handle) const
+        -> FATCache* {
+        auto it = _fat_cache_table.find(mass_storage_dev_handle);
+        return it != _fat_cache_table.end() ? it->value->get() : nullptr;
+    }
+
     auto vm_mass_storage_device_read(Device::Handle dev_handle, void* buf, size_t buf_size, U32 lba)
         -> size_t {
         auto* dm = System::instance().get_module<Device::DeviceModule>(ModuleSelector::DEVICE);
@@ -81,9 +87,40 @@ namespace Rune::VFS {
         return _fat_engine->fat_get_eof_marker();
     }
 
+    auto VolumeManager::fat_cache_load(Device::Handle      mass_storage_dev_handle,
+                                       BIOSParameterBlock* bpb,
+                                       U32                 cluster_count) -> bool {
+        // The two reserved FAT entries precede the entries of the data clusters
+        SharedPointer<FATCache> cache(new FATCache(mass_storage_dev_handle,
+                                                   bpb,
+                                                   _fat_engine,
+                                                   cluster_count + 2,
+                                                   _fat_engine->get_fs_info_sector(bpb)));
+        if (!cache->preload()) return false;
+        _fat_cache_table.put(mass_storage_dev_handle, cache);
+        return true;
+    }
+
+    auto VolumeManager::fat_cache_flush(Device::Handle mass_storage_dev_handle) -> bool {
+        FATCache* cache = find_fat_cache(mass_storage_dev_handle);
+        return cache == nullptr || cache->flush();
+    }
+
+    auto VolumeManager::fat_cache_drop(Device::Handle mass_storage_dev_handle) -> bool {
+        bool flushed = fat_cache_flush(mass_storage_dev_handle);
+        _fat_cache_table.remove(mass_storage_dev_handle);
+        return flushed;
+    }
+
     auto VolumeManager::fat_read(Device::Handle      mass_storage_dev_handle,
                                  BIOSParameterBlock* bpb,
                                  size_t              cluster) const -> U32 {
+        FATCache* cache = find_fat_cache(mass_storage_dev_handle);
+        if (cache != nullptr) {
+            U32 fat_entry = 0;
+            return cache->read(cluster, fat_entry) ? fat_entry : _fat_engine->fat_get_eof_marker();
+        }
+
         U32 two_sector_size   = bpb->bytes_per_sector * 2;
         U32 byte_offset       = _fat_engine->fat_offset(cluster);
         U32 fat_sector_number = bpb->reserved_sector_count + (byte_offset / bpb->bytes_per_sector);
@@ -101,6 +138,9 @@ namespace Rune::VFS {
                                   BIOSParameterBlock* bpb,
                                   size_t              cluster,
                                   U32                 fat_value) -> bool {
+        FATCache* cache = find_fat_cache(mass_storage_dev_handle);
+        if (cache != nullptr) return cache->write(cluster, fat_value);
+
         U32 two_sector_size   = bpb->bytes_per_sector * 2;
         U32 byte_offset       = _fat_engine->fat_offset(cluster);
         U32 fat_sector_number = bpb->reserved_sector_count + (byte_offset / bpb->bytes_per_sector);
@@ -138,6 +178,14 @@ namespace Rune::VFS {
 
     auto VolumeManager::fat_find_next_free_cluster(Device::Handle      mass_storage_dev_handle,
                                                    BIOSParameterBlock* bpb) -> U32 {
+        FATCache* cache = find_fat_cache(mass_storage_dev_handle);
+        if (cache != nullptr) {
+            U32 free_cluster = 0;
+            return cache->find_free_run(cache->get_next_free(), 1, 1, free_cluster) > 0
+                       ? free_cluster
+                       : 0;
+        }
+
         auto cluster_size = static_cast<size_t>(bpb->bytes_per_sector * bpb->sectors_per_cluster);
         for (U32 i = 0; i < _fat_engine->fat_get_size(bpb); i += 2) {
             U8 fat[2 * cluster_size]; // NOLINT
@@ -155,6 +203,29 @@ namespace Rune::VFS {
         return 0;
     }
 
+    auto VolumeManager::fat_find_free_cluster_run(Device::Handle      mass_storage_dev_handle,
+                                                  BIOSParameterBlock* bpb,
+                                                  U32                 hint,
+                                                  U32                 min_length,
+                                                  U32                 max_length,
+                                                  U32&                out_first) -> U32 {
+        FATCache* cache = find_fat_cache(mass_storage_dev_handle);
+        if (cache == nullptr) {
+            out_first = fat_find_next_free_cluster(mass_storage_dev_handle, bpb);
+            return out_first > 0 ? 1 : 0;
+        }
+        return cache->find_free_run(hint == 0 ? cache->get_next_free() : hint,
+                                    min_length,
+                                    max_length,
+                                    out_first);
+    }
+
+    void VolumeManager::fat_set_next_free_cluster(Device::Handle mass_storage_dev_handle,
+                                                  U32            cluster) {
+        FATCache* cache = find_fat_cache(mass_storage_dev_handle);
+        if (cache != nullptr) cache->set_next_free(cluster);
+    }
+
     //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
     //                                          Data Region Manipulation
     //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -188,4 +259,32 @@ namespace Rune::VFS {
                == cluster_size;
     }
 
+    auto VolumeManager::data_cluster_run_read(Device::Handle      mass_storage_dev_handle,
+                                              BIOSParameterBlock* bpb,
+                                              void*               buf,
+                                              size_t              first_cluster,
+                                              size_t              cluster_count) const -> bool {
+        size_t run_size = static_cast<size_t>(bpb->bytes_per_sector * bpb->sectors_per_cluster)
+                          * cluster_count;
+        return vm_mass_storage_device_read(mass_storage_dev_handle,
+                                           buf,
+                                           run_size,
+                                           data_cluster_to_lba(bpb, first_cluster))
+               == run_size;
+    }
+
+    auto VolumeManager::data_cluster_run_write(Device::Handle      mass_storage_dev_handle,
+                                               BIOSParameterBlock* bpb,
+                                               void*               buf,
+                                               size_t              first_cluster,
+                                               size_t              cluster_count) -> bool {
+        size_t run_size = static_cast<size_t>(bpb->bytes_per_sector * bpb->sectors_per_cluster)
+                          * cluster_count;
+        return vm_mass_storage_device_write(mass_storage_dev_handle,
+                                            buf,
+                                            run_size,
+                                            data_cluster_to_lba(bpb, first_cluster))
+               == run_size;
+    }
+
 } // namespace Rune::VFS
\ No newline at end of file
@@ -24,6 +24,7 @@ namespace Rune::VFS {
     auto Node::is_closed() const -> bool { return _closed; }
 
     void Node::close() {
+        flush();
         _closed = true;
         _on_close();
     }
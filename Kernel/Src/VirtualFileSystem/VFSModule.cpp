@@ -16,6 +16,7 @@
 
 #include <VirtualFileSystem/VFSModule.h>
 
+#include <KRE/Math.h>
 #include <KRE/System/System.h>
 
 #include <Device/DeviceModule.h>
@@ -34,14 +35,11 @@ namespace Rune::VFS {
         SILENCE_UNUSED(boot_info)
 
         // Init event hook table
-        _event_hook_table.put(EventHook(EventHook::NODE_OPENED).to_string(),
-                              LinkedList<EventHandlerTableEntry>());
-        _event_hook_table.put(EventHook(EventHook::NODE_CLOSED).to_string(),
-                              LinkedList<EventHandlerTableEntry>());
-        _event_hook_table.put(EventHook(EventHook::DIRECTORY_STREAM_OPENED).to_string(),
-                              LinkedList<EventHandlerTableEntry>());
-        _event_hook_table.put(EventHook(EventHook::DIRECTORY_STREAM_CLOSED).to_string(),
-                              LinkedList<EventHandlerTableEntry>());
+        for (const EventHook evt_hook : {EventHook::NODE_OPENED,
+                                         EventHook::NODE_CLOSED,
+                                         EventHook::DIRECTORY_STREAM_OPENED,
+                                         EventHook::DIRECTORY_STREAM_CLOSED})
+            add_event_hook(evt_hook, evt_hook.to_string());
 
         System&        system     = System::instance();
         auto*          ds         = system.get_module<Device::DeviceModule>(ModuleSelector::DEVICE);
@@ -82,9 +80,8 @@ namespace Rune::VFS {
         //     if (!create_system_directory(k_subsys_dir)) return false;
         // }
 
-        // stdin, stdout and stderr reserve handles 0-2 -> Start handle counter at 3
-        _node_handle_counter.acquire();
-        _node_handle_counter.acquire();
+        // stdin, stdout and stderr reserve handles 0-2, the node table never hands them out because
+        // the generation bits of a handle are never zero
         return true;
     }
 
@@ -113,6 +110,31 @@ namespace Rune::VFS {
         return best_fit;
     }
 
+    void VFSModule::touch_node(const Path& path) {
+        _node_version_clock++;
+        auto it = _node_version_table.find(path);
+        if (it != _node_version_table.end()) {
+            *it->value = _node_version_clock;
+            return;
+        }
+
+        if (_node_version_table.size() >= NODE_VERSION_LIMIT) {
+            // Drop all node versions and move the mount version past them instead, this makes every
+            // cached node content stale once but keeps the table bounded
+            LinkedList<Path> paths;
+            for (const auto& e : _node_version_table) paths.add_back(*e.key);
+            for (const auto& p : paths) _node_version_table.remove(p);
+            _mount_version = _node_version_clock;
+            return;
+        }
+        _node_version_table.put(path, _node_version_clock);
+    }
+
+    void VFSModule::forget_node(const Path& path) {
+        // Versions are never handed out twice, the node gets a new one when it is created again
+        _node_version_table.remove(path);
+    }
+
     auto VFSModule::create_system_directory(const Path& path) -> bool {
         IOStatus st = create(path, Ember::NodeAttribute::DIRECTORY | Ember::NodeAttribute::SYSTEM);
         if (st != IOStatus::CREATED && st != IOStatus::FOUND) {
@@ -128,6 +150,18 @@ namespace Rune::VFS {
         return true;
     }
 
+    auto VFSModule::sync_mount_point(const MountPointInfo& mpi) -> bool {
+        UniquePointer<Driver>* driver = _driver_table.find(mpi.m_driver_name)->value;
+        if (driver == nullptr) return false;
+        if (!(*driver)->sync(mpi.m_mass_storage_device_handle)) {
+            LOGGER->warn(R"(Failed to sync storage device {} mounted at "{}".)",
+                         mpi.m_mass_storage_device_handle,
+                         mpi.m_mount_point.to_string());
+            return false;
+        }
+        return true;
+    }
+
     VFSModule::VFSModule() = default;
 
     //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -174,7 +208,7 @@ namespace Rune::VFS {
 
     auto VFSModule::get_node_table() const -> LinkedList<Node*> {
         LinkedList<Node*> files;
-        for (const auto& fe : _node_table) files.add_back(fe.value->get());
+        for (const auto& node : _node_table) files.add_back(node.get());
         return files;
     }
 
@@ -216,8 +250,7 @@ namespace Rune::VFS {
     }
 
     auto VFSModule::find_node(U16 handle) const -> SharedPointer<Node> {
-        auto it = _node_table.find(handle);
-        return it != _node_table.end() ? *it->value : SharedPointer<Node>(nullptr);
+        return _node_table.find(handle);
     }
 
     //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -226,7 +259,7 @@ namespace Rune::VFS {
 
     auto VFSModule::get_directory_stream_table() const -> LinkedList<DirectoryStream*> {
         LinkedList<DirectoryStream*> dir_streams;
-        for (const auto& dse : _dir_stream_table) dir_streams.add_back(dse.value->get());
+        for (const auto& dir_stream : _dir_stream_table) dir_streams.add_back(dir_stream.get());
         return dir_streams;
     }
 
@@ -241,8 +274,7 @@ namespace Rune::VFS {
     }
 
     auto VFSModule::find_directory_stream(U16 handle) const -> SharedPointer<DirectoryStream> {
-        auto it = _dir_stream_table.find(handle);
-        return it != _dir_stream_table.end() ? *it->value : SharedPointer<DirectoryStream>(nullptr);
+        return _dir_stream_table.find(handle);
     }
 
     //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -330,6 +362,7 @@ namespace Rune::VFS {
             // as long as it serves the device
             if (ms == MountStatus::ALREADY_MOUNTED) ms = MountStatus::MOUNTED;
             if (ms == MountStatus::MOUNTED) {
+                _mount_version = ++_node_version_clock;
                 _mount_point_table.put(
                     mount_point,
                     {.m_mount_point                = mount_point,
@@ -377,7 +410,8 @@ namespace Rune::VFS {
                 mst.to_string());
             return mst;
         }
-        bool success = _mount_point_table.remove(mount_point);
+        bool success   = _mount_point_table.remove(mount_point);
+        _mount_version = ++_node_version_clock;
         if (success)
             LOGGER->info(R"(The {} formatted storage device {} is no longer mounted at "{}")",
                          mpi.m_driver_name,
@@ -389,6 +423,20 @@ namespace Rune::VFS {
         return success ? MountStatus::UNMOUNTED : MountStatus::MOUNT_ERROR;
     }
 
+    auto VFSModule::sync() -> bool {
+        bool synced = true;
+        // Nodes can buffer written bytes -> They must be on the storage device before it is synced
+        for (const auto& node : _node_table) {
+            if (!node->flush()) {
+                LOGGER->warn(R"(Failed to flush node "{}-{}".)", node->handle, node->name);
+                synced = false;
+            }
+        }
+        for (const auto& mp_pair : _mount_point_table)
+            if (!sync_mount_point(*mp_pair.value)) synced = false; // NOLINT only end() is null
+        return synced;
+    }
+
     //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
     //                                          Filesystem Access
     //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -420,14 +468,17 @@ namespace Rune::VFS {
         IOStatus               st     = (*driver)->create(mpi.m_mass_storage_device_handle,
                                                           path.relative_to(mpi.m_mount_point),
                                                           attributes);
-        if (st == IOStatus::CREATED)
+        if (st == IOStatus::CREATED) {
+            touch_node(path);
+            sync_mount_point(mpi);
             LOGGER->debug(R"(Created FILE "{}" with attributes {:0=#8b})",
                           path.to_string(),
                           attributes);
-        else
+        } else {
             LOGGER->debug(R"(Failed to create FILE "{}". IO Status: {})",
                           path.to_string(),
                           st.to_string());
+        }
         return st;
     }
 
@@ -435,8 +486,9 @@ namespace Rune::VFS {
         -> IOStatus {
         if (!path.is_absolute()) return IOStatus::BAD_PATH;
 
-        if (!_node_handle_counter.has_more()) {
-            LOGGER->warn(R"(Cannot open "{}". The node handle counter is out of handles!)",
+        U16 node_handle = _node_table.acquire();
+        if (node_handle == Resource<U16>::HANDLE_NONE) {
+            LOGGER->warn(R"(Cannot open "{}". The node table is out of handles!)",
                          path.to_string());
             return IOStatus::OUT_OF_HANDLES;
         }
@@ -444,18 +496,18 @@ namespace Rune::VFS {
         MountPointInfo         mpi    = resolve(path);
         UniquePointer<Driver>* driver = _driver_table.find(mpi.m_driver_name)->value;
 
-        U16      node_handle = _node_handle_counter.acquire();
         Path     p           = path.relative_to(mpi.m_mount_point);
         IOStatus open_status = (*driver)->open(
             mpi.m_mass_storage_device_handle,
             mpi.m_mount_point,
             p,
             node_io_mode,
-            [this, path, node_handle] mutable -> void {
+            [this, path, node_handle, node_io_mode] mutable -> void {
                 // Remove node handle from node table
                 _node_table.remove(node_handle);
-                fire(EventHook(EventHook::NODE_CLOSED).to_string(),
-                     reinterpret_cast<void*>(&node_handle));
+                // The node content could have been modified through this node handle
+                if (node_io_mode != Ember::IOMode::READ) touch_node(path);
+                fire(EventHook::NODE_CLOSED, reinterpret_cast<void*>(&node_handle));
 
                 // Decrement node ref count
                 auto it = _node_ref_table.find(path);
@@ -486,14 +538,16 @@ namespace Rune::VFS {
                                           node_handle,
                                           path.get_file_name());
                     }
+                    sync_mount_point(resolve(path));
                 }
             },
             out);
         if (open_status == IOStatus::OPENED) {
+            if (node_io_mode != Ember::IOMode::READ) touch_node(path);
             out->handle = node_handle;
             _node_table.put(node_handle, out);
             out->name = path.get_file_name();
-            fire(EventHook(EventHook::NODE_OPENED).to_string(), &out->handle);
+            fire(EventHook::NODE_OPENED, &out->handle);
 
             // Increment FILE ref count
             auto it = _node_ref_table.find(path);
@@ -510,7 +564,7 @@ namespace Rune::VFS {
                           path.to_string(),
                           _node_ref_table.find(path)->value->m_ref_count);
         } else {
-            _node_handle_counter.release_last_acquired();
+            _node_table.remove(node_handle);
             LOGGER->debug(R"(Failed to open "{}". IOStatus={})",
                           path.to_string(),
                           open_status.to_string());
@@ -529,12 +583,11 @@ namespace Rune::VFS {
     }
 
     auto VFSModule::get_node_info(U16 node_handle, NodeInfo& out) -> IOStatus {
-        auto maybe_node = _node_table.find(node_handle);
-        if (maybe_node == _node_table.end()) return IOStatus::NOT_FOUND;
+        SharedPointer<Node> node = _node_table.find(node_handle);
+        if (!node) return IOStatus::NOT_FOUND;
 
-        SharedPointer<Node> node = *maybe_node->value;
-        out.node_path            = node->get_node_path().to_string();
-        out.size                 = node->get_size();
+        out.node_path = node->get_node_path().to_string();
+        out.size      = node->get_size();
 
         U8 node_attr = 0;
         if (node->has_attribute(Ember::NodeAttribute::READONLY))
@@ -552,6 +605,11 @@ namespace Rune::VFS {
         return IOStatus::FOUND;
     }
 
+    auto VFSModule::get_node_version(const Path& path) const -> U64 {
+        auto it = _node_version_table.find(path);
+        return it == _node_version_table.end() ? _mount_version : max(*it->value, _mount_version);
+    }
+
     auto VFSModule::delete_node(const Path& path) -> IOStatus {
         if (!path.is_absolute()) return IOStatus::BAD_PATH;
 
@@ -577,12 +635,15 @@ namespace Rune::VFS {
         if (delete_now) {
             IOStatus st = (*driver)->delete_node(mpi.m_mass_storage_device_handle,
                                                  path.relative_to(mpi.m_mount_point));
-            if (st == IOStatus::DELETED)
+            if (st == IOStatus::DELETED) {
+                forget_node(path);
+                sync_mount_point(mpi);
                 LOGGER->trace("Deleted '{}'", path.to_string());
-            else
+            } else {
                 LOGGER->trace("Failed to delete '{}'. IO Status: {}",
                               path.to_string(),
                               st.to_string());
+            }
             return st;
         }
         LOGGER->trace("Marked '{}' for deletion...", path.to_string());
@@ -594,18 +655,18 @@ namespace Rune::VFS {
         -> IOStatus {
         if (!path.is_absolute()) return IOStatus::BAD_PATH;
 
-        if (!_dir_stream_handle_counter.has_more()) return IOStatus::OUT_OF_HANDLES;
+        U16 dir_stream_handle = _dir_stream_table.acquire();
+        if (dir_stream_handle == Resource<U16>::HANDLE_NONE) return IOStatus::OUT_OF_HANDLES;
 
-        U16                    dir_stream_handle = _dir_stream_handle_counter.acquire();
-        MountPointInfo         mpi               = resolve(path);
-        UniquePointer<Driver>* driver            = _driver_table.find(mpi.m_driver_name)->value;
-        IOStatus               io_st             = (*driver)->open_directory_stream(
+        MountPointInfo         mpi    = resolve(path);
+        UniquePointer<Driver>* driver = _driver_table.find(mpi.m_driver_name)->value;
+        IOStatus               io_st  = (*driver)->open_directory_stream(
             mpi.m_mass_storage_device_handle,
             path.relative_to(mpi.m_mount_point),
             [this, dir_stream_handle, path] mutable -> void {
                 // Remove FILE handle from FILE table
                 _dir_stream_table.remove(dir_stream_handle);
-                fire(EventHook(EventHook::DIRECTORY_STREAM_CLOSED).to_string(),
+                fire(EventHook::DIRECTORY_STREAM_CLOSED,
                      reinterpret_cast<void*>(&dir_stream_handle));
                 LOGGER->trace(R"(Closed directory stream "{}-{}".)",
                               dir_stream_handle,
@@ -613,7 +674,7 @@ namespace Rune::VFS {
             },
             out);
         if (io_st != IOStatus::OPENED) {
-            _dir_stream_handle_counter.release_last_acquired();
+            _dir_stream_table.remove(dir_stream_handle);
             return io_st;
         }
 
@@ -621,8 +682,7 @@ namespace Rune::VFS {
         out->name   = path.to_string();
         LOGGER->trace(R"(Opened directory stream "{}-{}".)", dir_stream_handle, out->name);
         _dir_stream_table.put(dir_stream_handle, out);
-        fire(EventHook(EventHook::DIRECTORY_STREAM_OPENED).to_string(),
-             reinterpret_cast<void*>(&dir_stream_handle));
+        fire(EventHook::DIRECTORY_STREAM_OPENED, reinterpret_cast<void*>(&dir_stream_handle));
         return io_st;
     }
 } // namespace Rune::VFS
\ No newline at end of file
@@ -52,6 +52,7 @@ $ARCH
 $BIT
 $QEMU
 $RUN_UNIT_TESTS
+$SYSTEM_CALL_TRACE
 $SHUTDOWN_ON_SYSTEM_LOADER_EXIT
 
 #endif //RUNEOS_BUILD_INFO_H